@@ -0,0 +1,179 @@
+// Compares N windows that are cleared and swapped every frame with one
+// window that has N views drawn by drawViews and one swap.
+// usage: ViewBenchmark [nofViews] [nofFrames]
+
+#include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/View.h>
+#include <SDL2CPP/Window.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+uint32_t const GL_COLOR_BUFFER_BIT = 0x4000;
+uint32_t const GL_SCISSOR_TEST     = 0x0C11;
+
+struct GL {
+  void(SDLCALL* clearColor)(float, float, float, float);
+  void(SDLCALL* clear)(uint32_t);
+  void(SDLCALL* viewport)(int32_t, int32_t, int32_t, int32_t);
+  void(SDLCALL* scissor)(int32_t, int32_t, int32_t, int32_t);
+  void(SDLCALL* enable)(uint32_t);
+  void(SDLCALL* finish)();
+};
+
+template <typename T>
+void load(T& function, char const* name)
+{
+  function = reinterpret_cast<T>(SDL_GL_GetProcAddress(name));
+}
+
+bool loadGL(GL& gl)
+{
+  load(gl.clearColor, "glClearColor");
+  load(gl.clear, "glClear");
+  load(gl.viewport, "glViewport");
+  load(gl.scissor, "glScissor");
+  load(gl.enable, "glEnable");
+  load(gl.finish, "glFinish");
+  return gl.clearColor && gl.clear && gl.viewport && gl.scissor &&
+         gl.enable && gl.finish;
+}
+
+shared_ptr<Window> createWindow(MainLoop&     mainLoop,
+                                string const& name,
+                                uint32_t      width,
+                                uint32_t      height)
+{
+#if defined(SDL2CPP_NO_EXCEPTIONS)
+  auto window = make_shared<Window>(width, height);
+  if (!window->getStatus()) return nullptr;
+  if (window->createContext("context", 330u) == Window::INVALID_CONTEXT)
+    return nullptr;
+#else
+  shared_ptr<Window> window;
+  try {
+    window = make_shared<Window>(width, height);
+    window->createContext("context", 330u);
+  } catch (std::exception const&) {
+    return nullptr;
+  }
+#endif
+  if (!mainLoop.addWindow(name, window)) return nullptr;
+  return window;
+}
+
+template <typename Frame>
+double measure(MainLoop& mainLoop, GL const& gl, int nofFrames,
+               Frame const& frame)
+{
+  // the first frames allocate swapchain images
+  for (int i = 0; i < 3; ++i) {
+    frame(i);
+    mainLoop.presentAll();
+  }
+  gl.finish();
+  auto const start = chrono::steady_clock::now();
+  for (int i = 0; i < nofFrames; ++i) {
+    SDL_PumpEvents();
+    frame(i);
+    mainLoop.presentAll();
+  }
+  gl.finish();
+  chrono::duration<double, milli> const time =
+      chrono::steady_clock::now() - start;
+  return time.count() / nofFrames;
+}
+
+float color(int frame, size_t index)
+{
+  return float((frame + index) % 16) / 15.f;
+}
+
+bool benchmarkWindows(size_t nofViews, int nofFrames, double& time)
+{
+  MainLoop mainLoop;
+  mainLoop.setSwapInterval(0);
+  vector<shared_ptr<Window>> windows;
+  for (size_t i = 0; i < nofViews; ++i) {
+    auto window = createWindow(mainLoop, "window" + to_string(i), 128, 128);
+    if (!window) return false;
+    windows.push_back(window);
+  }
+  GL gl;
+  if (!loadGL(gl)) return false;
+  time = measure(mainLoop, gl, nofFrames, [&](int frame) {
+    for (size_t i = 0; i < windows.size(); ++i) {
+      windows[i]->makeCurrent("context");
+      gl.clearColor(color(frame, i), 0.f, 0.f, 1.f);
+      gl.clear(GL_COLOR_BUFFER_BIT);
+    }
+  });
+  return true;
+}
+
+bool benchmarkViews(size_t nofViews, int nofFrames, double& time)
+{
+  MainLoop   mainLoop;
+  mainLoop.setSwapInterval(0);
+  auto const columns = size_t(ceil(sqrt(double(nofViews))));
+  auto const rows    = (nofViews + columns - 1) / columns;
+  auto const window  = createWindow(mainLoop, "window", uint32_t(128 * columns),
+                                    uint32_t(128 * rows));
+  if (!window) return false;
+  GL gl;
+  if (!loadGL(gl)) return false;
+  gl.enable(GL_SCISSOR_TEST);
+
+  int frame = 0;
+  for (size_t i = 0; i < nofViews; ++i) {
+    auto view = make_shared<View>(
+        float(i % columns) / columns, float(i / columns) / rows,
+        1.f / columns, 1.f / rows);
+    view->setDrawCallback([&, i](View const& drawn) {
+      int32_t  x, y;
+      uint32_t width, height;
+      drawn.getGLViewport(x, y, width, height);
+      gl.viewport(x, y, int32_t(width), int32_t(height));
+      gl.scissor(x, y, int32_t(width), int32_t(height));
+      gl.clearColor(color(frame, i), 0.f, 0.f, 1.f);
+      gl.clear(GL_COLOR_BUFFER_BIT);
+    });
+    window->addView("view" + to_string(i), view);
+  }
+  time = measure(mainLoop, gl, nofFrames, [&](int currentFrame) {
+    frame = currentFrame;
+    window->makeCurrent("context");
+    window->drawViews();
+  });
+  return true;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  size_t const nofViews  = argc > 1 ? size_t(atoi(argv[1])) : 16;
+  int const    nofFrames = argc > 2 ? atoi(argv[2]) : 300;
+  if (nofViews == 0 || nofFrames <= 0) {
+    fprintf(stderr, "usage: %s [nofViews] [nofFrames]\n", argv[0]);
+    return 1;
+  }
+
+  double windowsTime, viewsTime;
+  if (!benchmarkWindows(nofViews, nofFrames, windowsTime) ||
+      !benchmarkViews(nofViews, nofFrames, viewsTime)) {
+    fprintf(stderr, "OpenGL window cannot be created: %s\n", SDL_GetError());
+    return 1;
+  }
+  printf("%zu windows: %8.3f ms/frame\n", nofViews, windowsTime);
+  printf("%zu views  : %8.3f ms/frame\n", nofViews, viewsTime);
+  return 0;
+}
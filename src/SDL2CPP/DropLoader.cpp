@@ -0,0 +1,197 @@
+#include <SDL2CPP/DropLoader.h>
+
+#include <algorithm>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+// pages are touched in chunks, progress is reported after every chunk
+uint64_t const chunkSize = 64ull << 20;
+uint64_t const pageSize  = 4096;
+// stop request is checked after this many bytes, so destructor does not
+// wait for page faults of the whole chunk
+uint64_t const stopCheckSize = 1ull << 20;
+}  // namespace
+
+/**
+ * @brief Creates loader of dropped files, I/O thread is started with the
+ * first batch
+ *
+ * @param windowId id of window that receives notification events
+ */
+DropLoader::DropLoader(uint32_t windowId) : windowId(windowId)
+{
+  // register the event type on main thread
+  getEventType();
+}
+
+/**
+ * @brief Stops I/O thread, batch that is being loaded is abandoned
+ * It waits at most for page faults of stopCheckSize bytes.
+ */
+DropLoader::~DropLoader()
+{
+  {
+    lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  condition.notify_all();
+  if (worker.joinable()) worker.join();
+}
+
+/**
+ * @brief sets callback that receives loaded batch on main thread
+ *
+ * @param callback callback
+ */
+void DropLoader::setBatchCallback(BatchCallback const& callback)
+{
+  batchCallback = callback;
+}
+
+/**
+ * @brief sets callback that receives loading progress on main thread
+ *
+ * @param callback callback
+ */
+void DropLoader::setProgressCallback(ProgressCallback const& callback)
+{
+  progressCallback = callback;
+}
+
+/**
+ * @brief Starts collecting paths of new batch (SDL_DROPBEGIN)
+ */
+void DropLoader::begin()
+{
+  if (collecting) submit();
+  collecting = true;
+}
+
+/**
+ * @brief Adds dropped file into current batch (SDL_DROPFILE)
+ * File that is dropped outside of SDL_DROPBEGIN..SDL_DROPCOMPLETE is loaded
+ * as a batch on its own.
+ *
+ * @param path path to file
+ */
+void DropLoader::addFile(string const& path)
+{
+  paths.push_back(path);
+  if (!collecting) submit();
+}
+
+/**
+ * @brief Sends collected batch to I/O thread (SDL_DROPCOMPLETE)
+ */
+void DropLoader::complete()
+{
+  collecting = false;
+  submit();
+}
+
+/**
+ * @brief Calls callbacks with results that are ready, it is called on main
+ * thread when event of getEventType arrives
+ */
+void DropLoader::deliver()
+{
+  deque<Result> ready;
+  {
+    lock_guard<std::mutex> lock(mutex);
+    ready.swap(results);
+  }
+  for (auto const& result : ready) {
+    if (progressCallback) progressCallback(result.progress);
+    if (result.done && batchCallback) batchCallback(result.files);
+  }
+}
+
+/**
+ * @brief gets type of event that wakes main loop when results are ready
+ *
+ * @return registered user event type
+ */
+Uint32 DropLoader::getEventType()
+{
+  static Uint32 const type = SDL_RegisterEvents(1);
+  return type;
+}
+
+void DropLoader::submit()
+{
+  if (paths.empty()) return;
+  {
+    lock_guard<std::mutex> lock(mutex);
+    requests.push_back(Request{nofBatches++, move(paths)});
+  }
+  paths.clear();
+  if (!worker.joinable()) worker = thread(&DropLoader::work, this);
+  condition.notify_one();
+}
+
+void DropLoader::work()
+{
+  while (true) {
+    Request request;
+    {
+      unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&] { return stopping || !requests.empty(); });
+      if (stopping) return;
+      request = move(requests.front());
+      requests.pop_front();
+    }
+    load(request);
+  }
+}
+
+void DropLoader::load(Request const& request)
+{
+  Result result;
+  result.progress.batch    = request.batch;
+  result.progress.nofFiles = request.paths.size();
+  for (auto const& path : request.paths) {
+    auto const file = make_shared<MappedFile const>(path);
+    file->adviseSequential();
+    // files that failed to map (directories, FIFOs, ...) are never loaded
+    if (file->isMapped()) result.progress.totalBytes += file->getSize();
+    result.files.push_back(file);
+  }
+  post(Result(result));
+
+  // fault pages in here, so the main thread does not block on first access
+  uint8_t checksum = 0;
+  for (auto const& file : result.files) {
+    auto const data = file->getData();
+    if (data == nullptr) continue;
+    for (uint64_t offset = 0; offset < file->getSize(); offset += chunkSize) {
+      auto const end = min(file->getSize(), offset + chunkSize);
+      for (uint64_t page = offset; page < end; page += pageSize) {
+        if (page % stopCheckSize == 0 && stopping) return;
+        checksum ^= data[page];
+      }
+      result.progress.loadedBytes += end - offset;
+      Result progress;
+      progress.progress = result.progress;
+      post(move(progress));
+    }
+  }
+  volatile uint8_t sink = checksum;
+  static_cast<void>(sink);
+
+  result.done = true;
+  post(move(result));
+}
+
+void DropLoader::post(Result&& result)
+{
+  {
+    lock_guard<std::mutex> lock(mutex);
+    results.push_back(move(result));
+  }
+  SDL_Event event{};
+  event.type          = getEventType();
+  event.user.windowID = windowId;
+  SDL_PushEvent(&event);
+}
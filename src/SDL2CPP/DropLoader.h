@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL2CPP/Fwd.h>
+#include <SDL2CPP/MappedFile.h>
+#include <SDL2CPP/sdl2cpp_export.h>
+
+class sdl2cpp::DropLoader {
+ public:
+  using SharedFile = std::shared_ptr<MappedFile const>;
+  using Batch      = std::vector<SharedFile>;
+  struct Progress {
+    uint64_t batch       = 0;
+    size_t   nofFiles    = 0;
+    uint64_t loadedBytes = 0;
+    uint64_t totalBytes  = 0;
+  };
+  using BatchCallback    = std::function<void(Batch const&)>;
+  using ProgressCallback = std::function<void(Progress const&)>;
+
+  SDL2CPP_EXPORT DropLoader(uint32_t windowId);
+  SDL2CPP_EXPORT ~DropLoader();
+  SDL2CPP_EXPORT void          setBatchCallback(BatchCallback const& callback);
+  SDL2CPP_EXPORT void          setProgressCallback(ProgressCallback const& callback);
+  SDL2CPP_EXPORT void          begin();
+  SDL2CPP_EXPORT void          addFile(std::string const& path);
+  SDL2CPP_EXPORT void          complete();
+  SDL2CPP_EXPORT void          deliver();
+  SDL2CPP_EXPORT static Uint32 getEventType();
+
+ protected:
+  struct Request {
+    uint64_t                 batch;
+    std::vector<std::string> paths;
+  };
+  struct Result {
+    Progress progress;
+    bool     done = false;
+    Batch    files;
+  };
+  uint32_t                windowId;
+  BatchCallback           batchCallback;
+  ProgressCallback        progressCallback;
+  bool                    collecting = false;
+  uint64_t                nofBatches = 0;
+  std::vector<std::string> paths;
+  std::mutex              mutex;
+  std::condition_variable condition;
+  std::deque<Request>     requests;
+  std::deque<Result>      results;
+  // written under mutex for condition, read without it while pages are
+  // faulted in
+  std::atomic<bool>       stopping{false};
+  std::thread             worker;
+  void                    submit();
+  void                    work();
+  void                    load(Request const& request);
+  void                    post(Result&& result);
+};
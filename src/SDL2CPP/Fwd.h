@@ -3,6 +3,10 @@
 namespace sdl2cpp{
   class MainLoop;
   class Window;
+  class View;
+  class MappedFile;
+  class DropLoader;
+  class Status;
   namespace ex{
     class Exception;
     class Class;
@@ -12,5 +16,5 @@ namespace sdl2cpp{
     class MainLoopMethod;
     class CreateContext;
   }
-  void initSDL2();
+  Status initSDL2();
 }
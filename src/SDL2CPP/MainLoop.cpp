@@ -1,16 +1,19 @@
 #include <SDL2CPP/Exception.h>
 #include <SDL2CPP/MainLoop.h>
 #include <SDL2CPP/Window.h>
+#include <algorithm>
 #include <cassert>
 
 using namespace sdl2cpp;
 using namespace std;
 
-void sdl2cpp::initSDL2(){
+Status sdl2cpp::initSDL2(){
   if(SDL_WasInit(SDL_INIT_EVERYTHING)&SDL_INIT_EVERYTHING)
-    return;
+    return Status();
   if (SDL_Init(SDL_INIT_EVERYTHING) < 0)
-    throw ex::Exception(SDL_GetError());
+    SDL2CPP_THROW_OR_RETURN(ex::Exception(SDL_GetError()),
+                            Status(Status::INIT, "initSDL2"));
+  return Status();
 }
 
 /**
@@ -20,8 +23,8 @@ void sdl2cpp::initSDL2(){
  * arrives
  */
 MainLoop::MainLoop(bool pooling) {
-  initSDL2();
-  pooling = pooling;
+  status = initSDL2();
+  this->pooling = pooling;
 }
 
 /**
@@ -33,14 +36,27 @@ MainLoop::~MainLoop() { SDL_Quit(); }
  * @brief Adds window to this main loop
  *
  * @param name name identificator of window
- * @param window SDLWindow
+ * @param window SDLWindow, it has to be created successfully
+ *
+ * @return status
  */
-void MainLoop::addWindow(string const& name, SharedWindow const& window) {
-  if(!window)
-    throw ex::MainLoopMethod("addWindow","window cannot be nullptr");
+Status MainLoop::addWindow(string const& name, SharedWindow const& window) {
+  if(!window){
+    fail(Status::INVALID_ARGUMENT, "MainLoop::addWindow");
+    SDL2CPP_THROW_OR_RETURN(
+        ex::MainLoopMethod("addWindow","window cannot be nullptr"), status);
+  }
+  // getStatus of window reports any failed call, only failed constructor
+  // leaves it without SDL window
+  if(!window->getWindow()){
+    fail(Status::INVALID_ARGUMENT, "MainLoop::addWindow");
+    SDL2CPP_THROW_OR_RETURN(
+        ex::MainLoopMethod("addWindow","window was not created"), status);
+  }
   name2Window[name] = window;
   id2Name[window->getId()] = name;
   window->mainLoop = this;
+  return Status();
 }
 
 /**
@@ -107,12 +123,24 @@ bool MainLoop::isWindowRelatedEvent(SDL_Event const&e){
     e.type >= SDL_USEREVENT         ;
 }
 
+MainLoop::WindowId MainLoop::getWindowId(SDL_Event const&e){
+  // windowID of drop event is not at the same offset as in other events
+  if(e.type >= SDL_DROPFILE && e.type <= SDL_DROPCOMPLETE)
+    return e.drop.windowID;
+  return e.window.windowID;
+}
+
 /**
  * @brief Starts main loop
+ * Input, window and system events are dispatched first. User and application
+ * events are dispatched afterwards under per-frame budget
+ * (setUserEventBudget), events that do not fit into the budget stay in SDL
+ * queue for the next iteration.
+ *
+ * @return status, it is not ok if waiting for event failed
  */
-void MainLoop::operator()() {
+Status MainLoop::operator()() {
   running = true;
-  SDL_Event event;
   while (running) {
     if (name2Window.size() == 0) {
       running = false;
@@ -120,56 +148,147 @@ void MainLoop::operator()() {
     }
 
     if (!pooling)
-      if (SDL_WaitEvent(&event) == 0) {
-        throw ex::MainLoop(SDL_GetError());
-        return;
+      if (SDL_WaitEvent(nullptr) == 0) {
+        running = false;
+        fail(Status::WAIT_EVENT, "MainLoop");
+        SDL2CPP_THROW_OR_RETURN(ex::MainLoop(SDL_GetError()), status);
       }
 
-    while (true) {
-      if (pooling)
-        if (!SDL_PollEvent(&event)) break;
-
-      bool handledByEventHandler = false;
-      if (hasEventHandler())
-        handledByEventHandler = callEventHandler(event);
-
-      if(!handledByEventHandler){
-        if(isWindowRelatedEvent(event)){
-
-          auto const& winID = event.window.windowID;
-          auto windowIter = id2Name.find(winID);
-          bool handledByEventCallback = false;
-          if (windowIter != id2Name.end()) {
-            auto const& window = name2Window[windowIter->second];
-            if (window->hasEventCallback(event.type))
-              handledByEventCallback =
-                window->callEventCallback(event.type, event);
-          }
-
-          if (!handledByEventCallback) {
-            if (event.type == SDL_WINDOWEVENT) {
-              bool handledByWindowEventCallback = false;
-              if (windowIter != id2Name.end()) {
-                auto const& window = name2Window.at(windowIter->second);
-                if (window->hasWindowEventCallback(event.window.event))
-                  handledByWindowEventCallback =
-                    window->callWindowEventCallback(event.window.event,
-                        event);
-              }
-              (void)handledByWindowEventCallback;
-            }
-          }
-        }else{
-          auto it = eventCallbacks.find(event.type);
-          if(it != eventCallbacks.end())
-            it->second(event);
+    SDL_PumpEvents();
+    processPriorityLane();
+    processUserLane();
+    if (hasIdleCallback()) callIdleCallback();
+  }
+  return Status();
+}
+
+/**
+ * @brief gets status of the last failed call (constructor, addWindow,
+ * operator())
+ *
+ * @return status, it is ok if nothing failed
+ */
+Status MainLoop::getStatus() const {
+  return status;
+}
+
+Status MainLoop::fail(Status::Code code, char const* where) {
+  return status = Status(code, where);
+}
+
+namespace {
+// user lane consists of application events (SDL_QUIT, SDL_APP_*) and user
+// events, everything else is in priority lane
+Uint32 const firstPriorityEvent = SDL_APP_DIDENTERFOREGROUND + 1;
+Uint32 const lastPriorityEvent  = SDL_USEREVENT - 1;
+
+int countUserLaneEvents() {
+  return SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_QUIT,
+                        SDL_APP_DIDENTERFOREGROUND) +
+         SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_USEREVENT,
+                        SDL_LASTEVENT);
+}
+
+bool getUserLaneEvent(SDL_Event& event) {
+  return SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_QUIT,
+                        SDL_APP_DIDENTERFOREGROUND) > 0 ||
+         SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_USEREVENT,
+                        SDL_LASTEVENT) > 0;
+}
+}  // namespace
+
+void MainLoop::processPriorityLane() {
+  // events pushed by callbacks (input replay, ...) wait for the next
+  // iteration, like in user lane
+  auto const pending = SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT,
+                                      firstPriorityEvent, lastPriorityEvent);
+  SDL_Event event;
+  for (int i = 0; i < pending; ++i) {
+    if (SDL_PeepEvents(&event, 1, SDL_GETEVENT, firstPriorityEvent,
+                       lastPriorityEvent) <= 0)
+      break;
+    dispatchEvent(event);
+  }
+}
+
+void MainLoop::processUserLane() {
+  // events pushed while the lane is processed wait for the next iteration,
+  // so producers cannot keep this loop running forever
+  auto const pending = static_cast<size_t>(std::max(countUserLaneEvents(), 0));
+  laneStats.maxBacklog = std::max(laneStats.maxBacklog, pending);
+  auto limit = pending;
+  if (maxUserEvents != 0) limit = std::min(limit, maxUserEvents);
+
+  auto const start     = std::chrono::steady_clock::now();
+  size_t     processed = 0;
+  SDL_Event  event;
+  while (processed < limit) {
+    if (maxUserEventTime.count() != 0 && processed != 0 &&
+        std::chrono::steady_clock::now() - start >= maxUserEventTime)
+      break;
+    if (!getUserLaneEvent(event)) break;
+
+    // SDL timestamps events when they are pushed
+    auto const delay = std::chrono::milliseconds(
+        Uint32(SDL_GetTicks() - event.common.timestamp));
+    laneStats.maxDelay = std::max(
+        laneStats.maxDelay,
+        std::chrono::duration_cast<std::chrono::microseconds>(delay));
+    ++laneStats.processed;
+    ++processed;
+    dispatchEvent(event);
+  }
+
+  auto const carriedOver = pending > processed ? pending - processed : 0;
+  laneStats.carriedOver += carriedOver;
+  backlogFrames = carriedOver != 0 ? backlogFrames + 1 : 0;
+  laneStats.maxFrames = std::max(laneStats.maxFrames, backlogFrames);
+}
+
+void MainLoop::dispatchEvent(SDL_Event const& event) {
+  bool consumedByWindow = false;
+  if (isWindowRelatedEvent(event)) {
+    auto windowIter = id2Name.find(getWindowId(event));
+    if (windowIter != id2Name.end())
+      consumedByWindow =
+          name2Window.at(windowIter->second)->processEvent(event);
+  }
+
+  bool handledByEventHandler = consumedByWindow;
+  if (!consumedByWindow && hasEventHandler())
+    handledByEventHandler = callEventHandler(event);
+
+  if(handledByEventHandler)return;
+
+  if(isWindowRelatedEvent(event)){
+
+    auto windowIter = id2Name.find(getWindowId(event));
+    bool handledByEventCallback = false;
+    if (windowIter != id2Name.end()) {
+      auto const& window = name2Window[windowIter->second];
+      handledByEventCallback = window->callViewEventCallback(event);
+      if (!handledByEventCallback && window->hasEventCallback(event.type))
+        handledByEventCallback =
+          window->callEventCallback(event.type, event);
+    }
+
+    if (!handledByEventCallback) {
+      if (event.type == SDL_WINDOWEVENT) {
+        bool handledByWindowEventCallback = false;
+        if (windowIter != id2Name.end()) {
+          auto const& window = name2Window.at(windowIter->second);
+          if (window->hasWindowEventCallback(event.window.event))
+            handledByWindowEventCallback =
+              window->callWindowEventCallback(event.window.event,
+                  event);
         }
+        (void)handledByWindowEventCallback;
       }
-
-      if (!pooling)
-        if (!SDL_PollEvent(&event)) break;
     }
-    if (hasIdleCallback()) callIdleCallback();
+  }else{
+    auto it = eventCallbacks.find(event.type);
+    if(it != eventCallbacks.end())
+      it->second(event);
   }
 }
 
@@ -275,6 +394,89 @@ size_t MainLoop::getNofWindows() const {
   return name2Window.size();
 }
 
+/**
+ * @brief Swaps all registered OpenGL windows in one pass
+ * Only the vsync window waits for vertical blank, other windows are swapped
+ * with swap interval 0 before it, so the frame rate does not drop with
+ * number of windows. Context of the vsync window stays current.
+ */
+void MainLoop::presentAll() {
+  Window* vsync = nullptr;
+  auto const vsyncIt = name2Window.find(vsyncWindow);
+  if (vsyncIt != name2Window.end() && vsyncIt->second->canPresent())
+    vsync = vsyncIt->second.get();
+  for (auto const& it : name2Window) {
+    auto const& window = it.second;
+    if (!window->canPresent()) continue;
+    if (vsync == nullptr) {
+      vsync = window.get();
+      continue;
+    }
+    if (window.get() == vsync) continue;
+    window->present(0);
+  }
+  if (vsync != nullptr) vsync->present(swapInterval);
+}
+
+/**
+ * @brief sets swap interval of the window that waits for vsync in presentAll
+ *
+ * @param interval 0 - immediate, 1 - vsync, -1 - adaptive vsync
+ */
+void MainLoop::setSwapInterval(int interval) {
+  swapInterval = interval;
+}
+
+/**
+ * @brief gets swap interval of the window that waits for vsync in presentAll
+ *
+ * @return swap interval
+ */
+int MainLoop::getSwapInterval() const {
+  return swapInterval;
+}
+
+/**
+ * @brief selects window that waits for vsync in presentAll
+ * If it is not set (or it is not registered), the first window is used.
+ *
+ * @param name name of window
+ */
+void MainLoop::setVsyncWindow(std::string const& name) {
+  vsyncWindow = name;
+}
+
+/**
+ * @brief sets per-frame budget of user lane (user and application events)
+ * Events that exceed the budget stay in SDL queue for the next iteration,
+ * so SDL queue limit still pushes back on producers. At least one event is
+ * processed per iteration.
+ *
+ * @param maxEvents maximal number of events per iteration, 0 - unlimited
+ * @param maxTime maximal time spent in user lane per iteration, 0 - unlimited
+ */
+void MainLoop::setUserEventBudget(size_t                    maxEvents,
+                                  std::chrono::microseconds maxTime) {
+  maxUserEvents    = maxEvents;
+  maxUserEventTime = maxTime;
+}
+
+/**
+ * @brief gets counters of user lane
+ *
+ * @return counters
+ */
+MainLoop::EventLaneStats MainLoop::getEventLaneStats() const {
+  return laneStats;
+}
+
+/**
+ * @brief resets counters of user lane
+ */
+void MainLoop::resetEventLaneStats() {
+  laneStats = EventLaneStats();
+}
+
 void MainLoop::callIdleCallback() {
   assert(idleCallback != nullptr);
   idleCallback();
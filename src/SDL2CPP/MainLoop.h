@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -7,6 +8,7 @@
 
 #include <SDL.h>
 #include <SDL2CPP/Fwd.h>
+#include <SDL2CPP/Status.h>
 #include <SDL2CPP/sdl2cpp_export.h>
 
 class sdl2cpp::MainLoop {
@@ -17,15 +19,29 @@ class sdl2cpp::MainLoop {
   using ConstNameIterator = Name2Window::const_iterator;
   using Id2Name           = std::map<WindowId, std::string>;
   using ConstIdIterator   = Id2Name::const_iterator;
+  struct EventLaneStats {
+    // dispatched user lane events
+    uint64_t                  processed   = 0;
+    // sum of events left for the next iteration over all iterations
+    uint64_t                  carriedOver = 0;
+    // most user lane events pending at the beginning of an iteration
+    size_t                    maxBacklog  = 0;
+    // most consecutive iterations that carried events over
+    uint64_t                  maxFrames   = 0;
+    // longest time between pushing and dispatching of an event, resolution
+    // is 1 ms because SDL timestamps events in milliseconds
+    std::chrono::microseconds maxDelay    = std::chrono::microseconds(0);
+  };
 
   SDL2CPP_EXPORT MainLoop(bool pooling = true);
   SDL2CPP_EXPORT ~MainLoop();
-  SDL2CPP_EXPORT void addWindow(std::string const& name, SharedWindow const& window);
+  SDL2CPP_EXPORT Status addWindow(std::string const& name, SharedWindow const& window);
   SDL2CPP_EXPORT void removeWindow(std::string const& name);
   SDL2CPP_EXPORT void removeWindow(uint32_t const& id);
   SDL2CPP_EXPORT bool hasWindow(std::string const& name) const;
   SDL2CPP_EXPORT SharedWindow const& getWindow(std::string const& name) const;
-  SDL2CPP_EXPORT void                operator()();
+  SDL2CPP_EXPORT Status              operator()();
+  SDL2CPP_EXPORT Status              getStatus() const;
   SDL2CPP_EXPORT void                stop();
   SDL2CPP_EXPORT void                setIdleCallback(std::function<void()> const& callback);
   SDL2CPP_EXPORT bool                hasIdleCallback() const;
@@ -37,6 +53,15 @@ class sdl2cpp::MainLoop {
   SDL2CPP_EXPORT ConstIdIterator   idBegin() const;
   SDL2CPP_EXPORT ConstIdIterator   idEnd() const;
   SDL2CPP_EXPORT size_t            getNofWindows() const;
+  SDL2CPP_EXPORT void              presentAll();
+  SDL2CPP_EXPORT void              setSwapInterval(int interval);
+  SDL2CPP_EXPORT int               getSwapInterval() const;
+  SDL2CPP_EXPORT void              setVsyncWindow(std::string const& name);
+  SDL2CPP_EXPORT void              setUserEventBudget(
+                   size_t                    maxEvents,
+                   std::chrono::microseconds maxTime = std::chrono::microseconds(0));
+  SDL2CPP_EXPORT EventLaneStats    getEventLaneStats() const;
+  SDL2CPP_EXPORT void              resetEventLaneStats();
 
  protected:
   std::function<bool(SDL_Event const&)> eventHandler = nullptr;
@@ -46,7 +71,19 @@ class sdl2cpp::MainLoop {
   bool                                  running      = false;
   Name2Window                           name2Window;
   Id2Name                               id2Name;
+  int                                   swapInterval = 1;
+  std::string                           vsyncWindow;
+  size_t                                maxUserEvents    = 0;
+  std::chrono::microseconds             maxUserEventTime = std::chrono::microseconds(0);
+  uint64_t                              backlogFrames    = 0;
+  EventLaneStats                        laneStats;
+  Status                                status;
   void                                  callIdleCallback();
+  Status                                fail(Status::Code code, char const* where);
   bool                                  isWindowRelatedEvent(SDL_Event const&e);
+  WindowId                              getWindowId(SDL_Event const&e);
+  void                                  processPriorityLane();
+  void                                  processUserLane();
+  void                                  dispatchEvent(SDL_Event const& event);
   bool callEventHandler(SDL_Event const& event);
 };
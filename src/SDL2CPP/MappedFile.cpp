@@ -0,0 +1,161 @@
+#include <SDL2CPP/MappedFile.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace sdl2cpp;
+using namespace std;
+
+/**
+ * @brief Maps file into memory as read only view
+ * It does not throw, isMapped and getError describe the result, because it
+ * is usually called on a background thread. Only regular files are mapped.
+ *
+ * @param path path to file
+ */
+MappedFile::MappedFile(string const& path) : path(path)
+{
+#if defined(_WIN32)
+  file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                     OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    file  = nullptr;
+    error = "CreateFile failed with error " + to_string(GetLastError());
+    return;
+  }
+  if (GetFileType(file) != FILE_TYPE_DISK) {
+    error = "not a regular file";
+    return;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize)) {
+    error = "GetFileSizeEx failed with error " + to_string(GetLastError());
+    return;
+  }
+  size = static_cast<uint64_t>(fileSize.QuadPart);
+  if (size == 0) {
+    mapped = true;
+    return;
+  }
+  mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    error = "CreateFileMapping failed with error " + to_string(GetLastError());
+    return;
+  }
+  data = static_cast<uint8_t const*>(
+      MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+  if (data == nullptr) {
+    error = "MapViewOfFile failed with error " + to_string(GetLastError());
+    return;
+  }
+  mapped = true;
+#else
+  // open of FIFO without writer would block forever, the file is only
+  // mapped, so non-blocking descriptor does not matter for regular files
+  int const fd = open(path.c_str(), O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+  if (fd < 0) {
+    error = string("open - ") + strerror(errno);
+    return;
+  }
+  struct stat info;
+  if (fstat(fd, &info) < 0) {
+    error = string("fstat - ") + strerror(errno);
+    close(fd);
+    return;
+  }
+  // directories, FIFOs and devices cannot be mapped or report no size
+  if (!S_ISREG(info.st_mode)) {
+    error = "not a regular file";
+    close(fd);
+    return;
+  }
+  size = static_cast<uint64_t>(info.st_size);
+  if (size == 0) {
+    close(fd);
+    mapped = true;
+    return;
+  }
+#if defined(POSIX_FADV_SEQUENTIAL)
+  posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+  void* const ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (ptr == MAP_FAILED) {
+    error = string("mmap - ") + strerror(errno);
+    return;
+  }
+  data   = static_cast<uint8_t const*>(ptr);
+  mapped = true;
+#endif
+}
+
+/**
+ * @brief Unmaps file
+ */
+MappedFile::~MappedFile()
+{
+#if defined(_WIN32)
+  if (data) UnmapViewOfFile(data);
+  if (mapping) CloseHandle(mapping);
+  if (file) CloseHandle(file);
+#else
+  if (data) munmap(const_cast<uint8_t*>(data), size);
+#endif
+}
+
+/**
+ * @brief gets mapped data
+ *
+ * @return pointer to the first byte or nullptr if file is empty or not mapped
+ */
+uint8_t const* MappedFile::getData() const { return data; }
+
+/**
+ * @brief gets size of file
+ *
+ * @return size in bytes
+ */
+uint64_t MappedFile::getSize() const { return size; }
+
+/**
+ * @brief gets path of file
+ *
+ * @return path as it was passed to constructor
+ */
+string const& MappedFile::getPath() const { return path; }
+
+/**
+ * @brief Was file mapped successfully?
+ *
+ * @return true if data can be read
+ */
+bool MappedFile::isMapped() const { return mapped; }
+
+/**
+ * @brief gets description of failure
+ *
+ * @return error message or empty string
+ */
+string const& MappedFile::getError() const { return error; }
+
+/**
+ * @brief Hints kernel that the mapping will be read sequentially and soon,
+ * so it can start readahead
+ */
+void MappedFile::adviseSequential() const
+{
+#if !defined(_WIN32)
+  if (data == nullptr) return;
+  void* const ptr = const_cast<uint8_t*>(data);
+  madvise(ptr, size, MADV_SEQUENTIAL);
+  madvise(ptr, size, MADV_WILLNEED);
+#endif
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <SDL2CPP/Fwd.h>
+#include <SDL2CPP/sdl2cpp_export.h>
+
+class sdl2cpp::MappedFile {
+ public:
+  SDL2CPP_EXPORT MappedFile(std::string const& path);
+  SDL2CPP_EXPORT ~MappedFile();
+  MappedFile(MappedFile const&) = delete;
+  MappedFile& operator=(MappedFile const&) = delete;
+  SDL2CPP_EXPORT uint8_t const*     getData() const;
+  SDL2CPP_EXPORT uint64_t           getSize() const;
+  SDL2CPP_EXPORT std::string const& getPath() const;
+  SDL2CPP_EXPORT bool               isMapped() const;
+  SDL2CPP_EXPORT std::string const& getError() const;
+  SDL2CPP_EXPORT void               adviseSequential() const;
+
+ protected:
+  std::string    path;
+  std::string    error;
+  uint8_t const* data   = nullptr;
+  uint64_t       size   = 0;
+  bool           mapped = false;
+#if defined(_WIN32)
+  void* file    = nullptr;
+  void* mapping = nullptr;
+#endif
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+#include <SDL.h>
+#include <SDL2CPP/Fwd.h>
+
+// Fallible functions throw sdl2cpp::ex exceptions by default. If the library
+// is built with SDL2CPP_NO_EXCEPTIONS, they return sdl2cpp::Status instead
+// and the exception expression is never evaluated.
+#if defined(SDL2CPP_NO_EXCEPTIONS)
+#define SDL2CPP_THROW_OR_RETURN(exception, value) return value
+#else
+#define SDL2CPP_THROW_OR_RETURN(exception, value) throw exception
+#endif
+
+class sdl2cpp::Status {
+ public:
+  enum Code : uint8_t {
+    OK = 0,
+    INIT,
+    INVALID_ARGUMENT,
+    CREATE_WINDOW,
+    CREATE_CONTEXT,
+    MAKE_CURRENT,
+    SET_FULLSCREEN,
+    WAIT_EVENT,
+    VULKAN,
+  };
+  Status(Code code = OK, char const* where = "") : code(code), where(where) {}
+  bool        isOk() const { return code == OK; }
+  explicit    operator bool() const { return isOk(); }
+  Code        getCode() const { return code; }
+  char const* getWhere() const { return where; }
+  // SDL keeps the last error per thread, it is valid until another SDL call
+  // fails on this thread
+  char const* getSDLError() const { return isOk() ? "" : SDL_GetError(); }
+
+ protected:
+  Code        code;
+  char const* where;
+};
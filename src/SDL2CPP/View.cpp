@@ -0,0 +1,213 @@
+#include <SDL2CPP/View.h>
+
+#include <cassert>
+#include <cmath>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+int32_t scale(float relative, uint32_t size)
+{
+  return static_cast<int32_t>(lround(relative * static_cast<float>(size)));
+}
+}  // namespace
+
+/**
+ * @brief Creates new view, it has to be added to window by Window::addView
+ * Rectangle is relative to window size, (0,0) is top left corner and
+ * (1,1) is bottom right corner.
+ *
+ * @param x left edge
+ * @param y top edge
+ * @param width width
+ * @param height height
+ */
+View::View(float x, float y, float width, float height)
+    : relX(x), relY(y), relWidth(width), relHeight(height)
+{
+}
+
+/**
+ * @brief sets rectangle of view relative to window size
+ *
+ * @param x left edge
+ * @param y top edge
+ * @param width width
+ * @param height height
+ */
+void View::setRelativeRect(float x, float y, float width, float height)
+{
+  relX      = x;
+  relY      = y;
+  relWidth  = width;
+  relHeight = height;
+  relayout();
+}
+
+/**
+ * @brief Sets callback for particular event in this view
+ * Mouse events are delivered with coordinates relative to the view.
+ *
+ * @param eventType event type (SDL_KEYDOWN, SDL_MOUSEMOTION, ...)
+ * @param callback callback, callback has to return true if event was served
+ */
+void View::setEventCallback(EventType const&                        eventType,
+                            function<bool(SDL_Event const&)> const& callback)
+{
+  if (callback == nullptr) {
+    eventCallbacks.erase(eventType);
+    return;
+  }
+  eventCallbacks[eventType] = callback;
+}
+
+/**
+ * @brief Gets true if callback for particular event is present
+ *
+ * @param eventType event type (SDL_KEYDOWN, ...)
+ *
+ * @return returns true if this callback is present
+ */
+bool View::hasEventCallback(EventType const& eventType) const
+{
+  auto ii = eventCallbacks.find(eventType);
+  return ii != eventCallbacks.end() && ii->second != nullptr;
+}
+
+/**
+ * @brief sets callback that is called when size of view in window
+ * coordinates or in drawable pixels (getGLViewport) changes
+ * Callback receives size in drawable pixels, the size framebuffers and
+ * projections need, size in window coordinates is in getWidth/getHeight.
+ *
+ * @param callback callback
+ */
+void View::setResizeCallback(ResizeCallback const& callback)
+{
+  resizeCallback = callback;
+}
+
+/**
+ * @brief sets callback that is called by Window::drawViews
+ *
+ * @param callback callback
+ */
+void View::setDrawCallback(DrawCallback const& callback)
+{
+  drawCallback = callback;
+}
+
+/**
+ * @brief gets left edge in window coordinates
+ *
+ * @return left edge
+ */
+int32_t View::getX() const { return x; }
+
+/**
+ * @brief gets top edge in window coordinates
+ *
+ * @return top edge
+ */
+int32_t View::getY() const { return y; }
+
+/**
+ * @brief gets width in window coordinates
+ *
+ * @return width
+ */
+uint32_t View::getWidth() const { return width; }
+
+/**
+ * @brief gets height in window coordinates
+ *
+ * @return height
+ */
+uint32_t View::getHeight() const { return height; }
+
+/**
+ * @brief gets rectangle for glViewport/glScissor
+ * It is in drawable pixels with origin in bottom left corner.
+ *
+ * @param x left edge
+ * @param y bottom edge
+ * @param width width
+ * @param height height
+ */
+void View::getGLViewport(int32_t&  x,
+                         int32_t&  y,
+                         uint32_t& width,
+                         uint32_t& height) const
+{
+  x      = glX;
+  y      = glY;
+  width  = glWidth;
+  height = glHeight;
+}
+
+/**
+ * @brief Is point inside of this view?
+ *
+ * @param x x coordinate in window coordinates
+ * @param y y coordinate in window coordinates
+ *
+ * @return true if point is inside
+ */
+bool View::contains(int32_t x, int32_t y) const
+{
+  return x >= this->x && y >= this->y &&
+         x < this->x + static_cast<int32_t>(width) &&
+         y < this->y + static_cast<int32_t>(height);
+}
+
+void View::layout(uint32_t windowWidth,
+                  uint32_t windowHeight,
+                  uint32_t drawableWidth,
+                  uint32_t drawableHeight)
+{
+  this->windowWidth    = windowWidth;
+  this->windowHeight   = windowHeight;
+  this->drawableWidth  = drawableWidth;
+  this->drawableHeight = drawableHeight;
+  relayout();
+}
+
+void View::relayout()
+{
+  auto const oldWidth    = width;
+  auto const oldHeight   = height;
+  auto const oldGLWidth  = glWidth;
+  auto const oldGLHeight = glHeight;
+
+  x      = scale(relX, windowWidth);
+  y      = scale(relY, windowHeight);
+  width  = scale(relX + relWidth, windowWidth) - x;
+  height = scale(relY + relHeight, windowHeight) - y;
+
+  // GL origin is in bottom left corner
+  auto const top = scale(relY, drawableHeight);
+  glX      = scale(relX, drawableWidth);
+  glWidth  = scale(relX + relWidth, drawableWidth) - glX;
+  glHeight = scale(relY + relHeight, drawableHeight) - top;
+  glY      = static_cast<int32_t>(drawableHeight) - top -
+             static_cast<int32_t>(glHeight);
+
+  // drawable size can change without window size (moving to HiDPI monitor)
+  auto const resized = width != oldWidth || height != oldHeight ||
+                       glWidth != oldGLWidth || glHeight != oldGLHeight;
+  if (resizeCallback && resized) resizeCallback(glWidth, glHeight);
+}
+
+bool View::callEventCallback(EventType const& eventType,
+                             SDL_Event const& event)
+{
+  assert(eventCallbacks.count(eventType) != 0);
+  assert(eventCallbacks.at(eventType) != nullptr);
+  return eventCallbacks.at(eventType)(event);
+}
+
+void View::draw() const
+{
+  if (drawCallback) drawCallback(*this);
+}
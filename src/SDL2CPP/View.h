@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+
+#include <SDL.h>
+#include <SDL2CPP/Fwd.h>
+#include <SDL2CPP/sdl2cpp_export.h>
+
+class sdl2cpp::View {
+  friend class Window;
+
+ public:
+  using EventType      = uint32_t;
+  using ResizeCallback =
+      std::function<void(uint32_t glWidth, uint32_t glHeight)>;
+  using DrawCallback   = std::function<void(View const&)>;
+  SDL2CPP_EXPORT View(float x = 0.f, float y = 0.f, float width = 1.f,
+                      float height = 1.f);
+  SDL2CPP_EXPORT void setRelativeRect(float x, float y, float width,
+                                      float height);
+  SDL2CPP_EXPORT void setEventCallback(
+      EventType const&                             eventType,
+      std::function<bool(SDL_Event const&)> const& callback = nullptr);
+  SDL2CPP_EXPORT bool     hasEventCallback(EventType const& eventType) const;
+  SDL2CPP_EXPORT void     setResizeCallback(ResizeCallback const& callback);
+  SDL2CPP_EXPORT void     setDrawCallback(DrawCallback const& callback);
+  SDL2CPP_EXPORT int32_t  getX() const;
+  SDL2CPP_EXPORT int32_t  getY() const;
+  SDL2CPP_EXPORT uint32_t getWidth() const;
+  SDL2CPP_EXPORT uint32_t getHeight() const;
+  SDL2CPP_EXPORT void     getGLViewport(int32_t&  x,
+                                        int32_t&  y,
+                                        uint32_t& width,
+                                        uint32_t& height) const;
+  SDL2CPP_EXPORT bool     contains(int32_t x, int32_t y) const;
+
+ protected:
+  float    relX      = 0.f;
+  float    relY      = 0.f;
+  float    relWidth  = 1.f;
+  float    relHeight = 1.f;
+  int32_t  x         = 0;
+  int32_t  y         = 0;
+  uint32_t width     = 0;
+  uint32_t height    = 0;
+  int32_t  glX       = 0;
+  int32_t  glY       = 0;
+  uint32_t glWidth   = 0;
+  uint32_t glHeight  = 0;
+  uint32_t windowWidth    = 0;
+  uint32_t windowHeight   = 0;
+  uint32_t drawableWidth  = 0;
+  uint32_t drawableHeight = 0;
+  std::map<EventType, std::function<bool(SDL_Event const&)>> eventCallbacks;
+  ResizeCallback resizeCallback;
+  DrawCallback   drawCallback;
+  void layout(uint32_t windowWidth,
+              uint32_t windowHeight,
+              uint32_t drawableWidth,
+              uint32_t drawableHeight);
+  void relayout();
+  bool callEventCallback(EventType const& eventType, SDL_Event const& event);
+  void draw() const;
+};
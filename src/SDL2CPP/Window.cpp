@@ -2,29 +2,52 @@
 #include <SDL2CPP/MainLoop.h>
 #include <SDL2CPP/Window.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <iostream>
+#include <limits>
 
 using namespace sdl2cpp;
 using namespace std;
 
+const Window::ContextId Window::INVALID_CONTEXT;
+
+namespace {
+// SDL_GL_MakeCurrent binds per thread, so the last binding is tracked per
+// thread as well. Serials are used instead of pointers, so a context that is
+// deleted on another thread cannot be mistaken for a new context that got
+// the same address.
+std::atomic<uint64_t>                    nextSerial{1};
+thread_local uint64_t                    currentWindow  = 0;
+thread_local uint64_t                    currentContext = 0;
+thread_local Window::ContextSwitchStats  switchStats;
+}  // namespace
+
 /**
  * @brief Creates new Window
  *
  * @param width width of new window
  * @param height height of new window
+ * @param api rendering api, OPENGL windows use createContext/swap,
+ * VULKAN windows use createVulkanSurface/updateSwapchain
  */
-Window::Window(uint32_t width, uint32_t height)
+Window::Window(uint32_t width, uint32_t height, Api api)
+    : serial(nextSerial++), api(api)
 {
-  initSDL2();
+  status = initSDL2();
+  if (!status) return;
 
   //this should be changeable
-  SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+  if (api == OPENGL) SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
 
-  Uint32 flags = SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE;
+  Uint32 flags = api | SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE;
   window     = SDL_CreateWindow("", SDL_WINDOWPOS_CENTERED,
                               SDL_WINDOWPOS_CENTERED, width, height, flags);
-  if (!window) throw ex::Window(SDL_GetError());
+  if (!window) {
+    fail(Status::CREATE_WINDOW, "Window");
+    SDL2CPP_THROW_OR_RETURN(ex::Window(SDL_GetError()), );
+  }
   setWindowEventCallback(
       SDL_WINDOWEVENT_CLOSE,
       bind(&Window::defaultCloseCallback, this, placeholders::_1));
@@ -38,38 +61,37 @@ Window::~Window()
   // free contexts, otherwise it would cause memory leak on gpu (according to
   // CodeXL)
   contexts.clear();
-  SDL_DestroyWindow(window);
+  if (currentWindow == serial) Window::invalidateCurrent();
+  if (window) SDL_DestroyWindow(window);
 }
 
-void setContextMajorVersion(uint32_t version)
+// attribute setters return attribute that failed in Status::getWhere
+Status setContextMajorVersion(uint32_t version)
 {
   if (SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, version / 100) >= 0)
-    return;
-  throw ex::CreateContext(string("SDL_GL_CONTEXT_MAJOR_VERISON - ") +
-                          SDL_GetError());
+    return Status();
+  return Status(Status::CREATE_CONTEXT, "SDL_GL_CONTEXT_MAJOR_VERSION");
 }
 
-void setContextMinorVersion(uint32_t version)
+Status setContextMinorVersion(uint32_t version)
 {
   if (SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, (version % 100) / 10) >=
       0)
-    return;
-  throw ex::CreateContext(string("SDL_GL_CONTEXT_MINOR_VERISON - ") +
-                          SDL_GetError());
+    return Status();
+  return Status(Status::CREATE_CONTEXT, "SDL_GL_CONTEXT_MINOR_VERSION");
 }
 
-void setContextProfile(Window::Profile profile)
+Status setContextProfile(Window::Profile profile)
 {
-  if (SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, profile) >= 0) return;
-  throw ex::CreateContext(string("SDL_GL_CONTEXT_PROFILE_MASK - ") +
-                          SDL_GetError());
+  if (SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, profile) >= 0)
+    return Status();
+  return Status(Status::CREATE_CONTEXT, "SDL_GL_CONTEXT_PROFILE_MASK");
 }
 
-void setContextFlags(Window::Flag flags)
+Status setContextFlags(Window::Flag flags)
 {
-  if (SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, flags) >= 0) return;
-  throw ex::CreateContext(string("SDL_GL_CONTEXT_FLAGS - ") +
-                          SDL_GetError());
+  if (SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, flags) >= 0) return Status();
+  return Status(Status::CREATE_CONTEXT, "SDL_GL_CONTEXT_FLAGS");
 }
 
 /**
@@ -80,25 +102,49 @@ void setContextFlags(Window::Flag flags)
  * @param profile context profile
  * @param flags context flags, debug context ...
  *
+ * @return handle of the context, it can be passed to makeCurrent, or
+ * INVALID_CONTEXT if creation failed (getStatus describes the failure)
  */
-void Window::createContext(string const& name,
+Window::ContextId Window::createContext(string const& name,
                            uint32_t           version,
                            Profile            profile,
                            Flag               flags)
 {
-  setContextMajorVersion(version);
-  setContextMinorVersion(version);
-  setContextProfile(profile);
-  setContextFlags(flags);
+  if (api != OPENGL) {
+    fail(Status::INVALID_ARGUMENT, "Window::createContext");
+    SDL2CPP_THROW_OR_RETURN(
+        ex::CreateContext("window was not created with OPENGL api"),
+        INVALID_CONTEXT);
+  }
+  Status attributes;
+  if (!(attributes = setContextMajorVersion(version)) ||
+      !(attributes = setContextMinorVersion(version)) ||
+      !(attributes = setContextProfile(profile)) ||
+      !(attributes = setContextFlags(flags))) {
+    fail(attributes.getCode(), attributes.getWhere());
+    SDL2CPP_THROW_OR_RETURN(
+        ex::CreateContext(string(attributes.getWhere()) + " - " +
+                          SDL_GetError()),
+        INVALID_CONTEXT);
+  }
 
-  SharedSDLContext ctx = shared_ptr<SDL_GLContext>(
-      new SDL_GLContext, [&](SDL_GLContext* ctx) {
-        if (*ctx) SDL_GL_DeleteContext(*ctx);
+  SharedSDLContext ctx =
+      shared_ptr<Context>(new Context, [](Context* ctx) {
+        if (ctx->serial == currentContext) Window::invalidateCurrent();
+        if (ctx->handle) SDL_GL_DeleteContext(ctx->handle);
         delete ctx;
       });
-  *ctx = SDL_GL_CreateContext(window);
-  if (*ctx == nullptr) throw ex::CreateContext(SDL_GetError());
-  contexts[name] = ctx;
+  ctx->handle = SDL_GL_CreateContext(window);
+  ctx->serial = nextSerial++;
+  if (ctx->handle == nullptr) {
+    fail(Status::CREATE_CONTEXT, "Window::createContext");
+    SDL2CPP_THROW_OR_RETURN(ex::CreateContext(SDL_GetError()),
+                            INVALID_CONTEXT);
+  }
+  // SDL_GL_CreateContext makes the new context current
+  currentWindow  = serial;
+  currentContext = ctx->serial;
+  return internContext(name, ctx);
 }
 
 /**
@@ -107,25 +153,107 @@ void Window::createContext(string const& name,
  * @param name name of this windows context
  * @param other other window
  * @param otherName name of other window context
+ *
+ * @return handle of the context in this window, or INVALID_CONTEXT if
+ * other window has no such context
+ */
+Window::ContextId Window::setContext(string const& name,
+                                     Window const&      other,
+                                     string const& otherName)
+{
+  auto const id = other.getContextId(otherName);
+  if (id == INVALID_CONTEXT) {
+    fail(Status::INVALID_ARGUMENT, "Window::setContext");
+    SDL2CPP_THROW_OR_RETURN(
+        ex::WindowMethod("setContext", "unknown context " + otherName),
+        INVALID_CONTEXT);
+  }
+  return internContext(name, other.contexts[id]);
+}
+
+/**
+ * @brief Gets handle of named context
+ *
+ * @param name name of context
+ *
+ * @return handle of context or INVALID_CONTEXT
  */
-void Window::setContext(string const& name,
-                        Window const&      other,
-                        string const& otherName)
+Window::ContextId Window::getContextId(string const& name) const
 {
-  assert(other.contexts.count(otherName) != 0);
-  contexts[name] = other.contexts.find(otherName)->second;
+  auto const it = contextIds.find(name);
+  if (it == contextIds.end()) return INVALID_CONTEXT;
+  return it->second;
 }
 
 /**
  * @brief Makes context current for this window
  *
  * @param name name of context that will be current
+ *
+ * @return status
  */
-void Window::makeCurrent(string const& name) const
+Status Window::makeCurrent(string const& name) const
 {
-  assert(contexts.count(name) != 0);
-  if (SDL_GL_MakeCurrent(window, *contexts.find(name)->second) < 0)
-    throw ex::WindowMethod("makeCurrent", SDL_GetError());
+  return makeCurrent(getContextId(name));
+}
+
+/**
+ * @brief Makes context current for this window
+ * The call is skipped if this window and context are already current
+ * on the calling thread.
+ *
+ * @param id handle of context that will be current
+ *
+ * @return status
+ */
+Status Window::makeCurrent(ContextId id) const
+{
+  if (id >= contexts.size()) {
+    fail(Status::INVALID_ARGUMENT, "Window::makeCurrent");
+    SDL2CPP_THROW_OR_RETURN(
+        ex::WindowMethod("makeCurrent", "unknown context"), status);
+  }
+  auto const& ctx = *contexts[id];
+  if (currentWindow == serial && currentContext == ctx.serial) {
+    ++switchStats.skipped;
+    return Status();
+  }
+  if (SDL_GL_MakeCurrent(window, ctx.handle) < 0) {
+    invalidateCurrent();
+    fail(Status::MAKE_CURRENT, "Window::makeCurrent");
+    SDL2CPP_THROW_OR_RETURN(ex::WindowMethod("makeCurrent", SDL_GetError()),
+                            status);
+  }
+  currentWindow  = serial;
+  currentContext = ctx.serial;
+  ++switchStats.performed;
+  return Status();
+}
+
+/**
+ * @brief Gets context switch counters of the calling thread
+ *
+ * @return number of performed and skipped makeCurrent calls
+ */
+Window::ContextSwitchStats Window::getContextSwitchStats()
+{
+  return switchStats;
+}
+
+/**
+ * @brief Resets context switch counters of the calling thread
+ */
+void Window::resetContextSwitchStats() { switchStats = ContextSwitchStats(); }
+
+/**
+ * @brief Forgets which window and context are current on the calling thread
+ * It has to be called if SDL_GL_MakeCurrent is used directly, the next
+ * makeCurrent will always switch.
+ */
+void Window::invalidateCurrent()
+{
+  currentWindow  = 0;
+  currentContext = 0;
 }
 
 /**
@@ -239,11 +367,17 @@ uint32_t Window::getHeight() const
  * @brief sets fullscreen
  *
  * @param type fullscreen type
+ *
+ * @return status
  */
-void Window::setFullscreen(Fullscreen const& type)
+Status Window::setFullscreen(Fullscreen const& type)
 {
-  if (SDL_SetWindowFullscreen(window, type))
-    throw ex::WindowMethod("setFullscreen", SDL_GetError());
+  if (SDL_SetWindowFullscreen(window, type)) {
+    fail(Status::SET_FULLSCREEN, "Window::setFullscreen");
+    SDL2CPP_THROW_OR_RETURN(ex::WindowMethod("setFullscreen", SDL_GetError()),
+                            status);
+  }
+  return Status();
 }
 
 /**
@@ -261,9 +395,408 @@ Window::Fullscreen Window::getFullscreen()
 
 SDL_GLContext Window::getContext(string const& name) const
 {
-  auto const it = contexts.find(name);
-  if (it == contexts.end()) return nullptr;
-  return *it->second;
+  auto const id = getContextId(name);
+  if (id == INVALID_CONTEXT) return nullptr;
+  return getContext(id);
+}
+
+SDL_GLContext Window::getContext(ContextId id) const
+{
+  if (id >= contexts.size()) return nullptr;
+  return contexts[id]->handle;
+}
+
+Window::ContextId Window::internContext(string const&           name,
+                                        SharedSDLContext const& ctx)
+{
+  auto const it = contextIds.find(name);
+  if (it != contextIds.end()) {
+    contexts[it->second] = ctx;
+    return it->second;
+  }
+  auto const id = static_cast<ContextId>(contexts.size());
+  contexts.push_back(ctx);
+  contextIds[name] = id;
+  return id;
+}
+
+/**
+ * @brief gets rendering api of this window
+ *
+ * @return OPENGL or VULKAN
+ */
+Window::Api Window::getApi() const { return api; }
+
+/**
+ * @brief gets status of the last failed call (constructor, createContext,
+ * makeCurrent, ...)
+ *
+ * @return status, it is ok if nothing failed
+ */
+Status Window::getStatus() const { return status; }
+
+Status Window::fail(Status::Code code, char const* where) const
+{
+  return status = Status(code, where);
+}
+
+/**
+ * @brief gets instance extensions required to present to this window
+ *
+ * @return extension names, they are owned by SDL, empty on failure
+ */
+vector<char const*> Window::getVulkanInstanceExtensions() const
+{
+  assert(api == VULKAN);
+  unsigned            count = 0;
+  vector<char const*> extensions;
+  if (SDL_Vulkan_GetInstanceExtensions(window, &count, nullptr)) {
+    extensions.resize(count);
+    if (SDL_Vulkan_GetInstanceExtensions(window, &count, extensions.data()))
+      return extensions;
+  }
+  fail(Status::VULKAN, "Window::getVulkanInstanceExtensions");
+  SDL2CPP_THROW_OR_RETURN(
+      ex::WindowMethod("getVulkanInstanceExtensions", SDL_GetError()),
+      vector<char const*>());
+}
+
+/**
+ * @brief Creates surface of this window
+ * The surface is owned by the caller, it has to be destroyed with
+ * vkDestroySurfaceKHR before instance is destroyed.
+ *
+ * @param instance instance created with getVulkanInstanceExtensions enabled
+ *
+ * @return new surface, null handle on failure
+ */
+VkSurfaceKHR Window::createVulkanSurface(VkInstance instance) const
+{
+  assert(api == VULKAN);
+  VkSurfaceKHR surface{};
+  if (!SDL_Vulkan_CreateSurface(window, instance, &surface)) {
+    fail(Status::VULKAN, "Window::createVulkanSurface");
+    SDL2CPP_THROW_OR_RETURN(
+        ex::WindowMethod("createVulkanSurface", SDL_GetError()),
+        VkSurfaceKHR{});
+  }
+  return surface;
+}
+
+/**
+ * @brief gets size of window in pixels (it can differ from window size on
+ * high-dpi displays)
+ *
+ * @param width width of drawable
+ * @param height height of drawable
+ */
+void Window::getDrawableSize(uint32_t& width, uint32_t& height) const
+{
+  int size[2];
+  if (api == VULKAN)
+    SDL_Vulkan_GetDrawableSize(window, size + 0, size + 1);
+  else
+    SDL_GL_GetDrawableSize(window, size + 0, size + 1);
+  width  = size[0];
+  height = size[1];
+}
+
+/**
+ * @brief Sets callback that (re)creates swapchain
+ * It is called from updateSwapchain with drawable size after window was
+ * resized.
+ *
+ * @param callback callback
+ */
+void Window::setSwapchainCallback(SwapchainCallback const& callback)
+{
+  swapchainCallback = callback;
+  swapchainDirty    = true;
+}
+
+/**
+ * @brief Marks swapchain out of date (VK_ERROR_OUT_OF_DATE_KHR,
+ * VK_SUBOPTIMAL_KHR), next updateSwapchain will recreate it
+ */
+void Window::invalidateSwapchain() { swapchainDirty = true; }
+
+/**
+ * @brief Recreates swapchain if window was resized since last call
+ * It should be called once per frame before image is acquired.
+ *
+ * @return false if there is nothing to present to (window is minimized)
+ */
+bool Window::updateSwapchain()
+{
+  if (!swapchainDirty) return true;
+  uint32_t width, height;
+  getDrawableSize(width, height);
+  if (width == 0 || height == 0) return false;
+  if (swapchainCallback) swapchainCallback(width, height);
+  swapchainDirty = false;
+  return true;
+}
+
+/**
+ * @brief Can this window be presented by main loop?
+ *
+ * @return true if it is OPENGL window with at least one context
+ */
+bool Window::canPresent() const
+{
+  return api == OPENGL && !contexts.empty();
+}
+
+/**
+ * @brief Swaps buffers with given swap interval
+ * Swap interval is changed only if it differs from the last one that was
+ * requested for the context, so windows that share context get the right
+ * interval even on drivers that keep it per context.
+ *
+ * @param interval 0 - immediate, 1 - vsync, -1 - adaptive vsync
+ */
+void Window::present(int interval)
+{
+  assert(canPresent());
+  if (!makeCurrent(ContextId(0))) return;
+  auto& ctx = *contexts[0];
+  if (ctx.requestedSwapInterval != interval) {
+    ctx.requestedSwapInterval = interval;
+    ctx.swapInterval          = interval;
+    // adaptive vsync is not supported everywhere, the fallback is not
+    // retried every frame because the request stays cached
+    if (SDL_GL_SetSwapInterval(interval) < 0 && interval == -1 &&
+        SDL_GL_SetSwapInterval(1) >= 0)
+      ctx.swapInterval = 1;
+  }
+  swap();
+}
+
+/**
+ * @brief gets swap interval that is in effect for the first context
+ * It can differ from the requested one if adaptive vsync is not supported.
+ *
+ * @return swap interval or INT_MIN if it was not set by presentAll
+ */
+int Window::getSwapInterval() const
+{
+  if (contexts.empty()) return numeric_limits<int>::min();
+  return contexts[0]->swapInterval;
+}
+
+/**
+ * @brief Adds view into this window
+ * Views split one window into many logical views that are drawn into one
+ * framebuffer and presented by one swap. Views added later are on top.
+ *
+ * @param name name identificator of view
+ * @param view view
+ */
+void Window::addView(string const& name, SharedView const& view)
+{
+  assert(view != nullptr);
+  if (hasView(name)) removeView(name);
+  name2View[name] = view;
+  viewOrder.push_back(view);
+  uint32_t drawableWidth, drawableHeight;
+  getDrawableSize(drawableWidth, drawableHeight);
+  view->layout(getWidth(), getHeight(), drawableWidth, drawableHeight);
+}
+
+/**
+ * @brief Removes view from this window
+ *
+ * @param name name identificator of view
+ */
+void Window::removeView(string const& name)
+{
+  auto const it = name2View.find(name);
+  if (it == name2View.end()) return;
+  auto const view = it->second;
+  name2View.erase(it);
+  viewOrder.erase(std::remove(viewOrder.begin(), viewOrder.end(), view),
+                  viewOrder.end());
+  if (hoveredView == view) hoveredView = nullptr;
+  if (focusedView == view) focusedView = nullptr;
+}
+
+/**
+ * @brief Has this window view with this name?
+ *
+ * @param name name of view
+ *
+ * @return true if this window has that view
+ */
+bool Window::hasView(string const& name) const
+{
+  return name2View.count(name) != 0;
+}
+
+/**
+ * @brief Gets view by its name
+ *
+ * @param name name of view
+ *
+ * @return view
+ */
+Window::SharedView const& Window::getView(string const& name) const
+{
+  assert(name2View.count(name) != 0);
+  return name2View.find(name)->second;
+}
+
+/**
+ * @brief gets number of views
+ *
+ * @return number of views
+ */
+size_t Window::getNofViews() const { return viewOrder.size(); }
+
+/**
+ * @brief Calls draw callbacks of all views, bottom view first
+ * Context has to be current, buffers are not swapped.
+ */
+void Window::drawViews() const
+{
+  for (auto const& view : viewOrder) view->draw();
+}
+
+void Window::layoutViews()
+{
+  if (viewOrder.empty()) return;
+  uint32_t drawableWidth, drawableHeight;
+  getDrawableSize(drawableWidth, drawableHeight);
+  auto const width  = getWidth();
+  auto const height = getHeight();
+  for (auto const& view : viewOrder)
+    view->layout(width, height, drawableWidth, drawableHeight);
+}
+
+Window::SharedView const& Window::findView(int32_t x, int32_t y) const
+{
+  static SharedView const none;
+  for (auto it = viewOrder.rbegin(); it != viewOrder.rend(); ++it)
+    if ((*it)->contains(x, y)) return *it;
+  return none;
+}
+
+/**
+ * @brief Routes event to view, it is called by main loop before event
+ * callbacks of this window
+ * Mouse events go to view under cursor (or to view that captured mouse
+ * by button press while button is held) with coordinates relative to the
+ * view. Keyboard and text events go to view that was clicked last.
+ *
+ * @param event event that belongs to this window
+ *
+ * @return true if event was served by view
+ */
+bool Window::callViewEventCallback(SDL_Event const& event)
+{
+  if (viewOrder.empty()) return false;
+  SharedView view;
+  SDL_Event  local = event;
+  switch (event.type) {
+    case SDL_MOUSEMOTION:
+      mouseX      = event.motion.x;
+      mouseY      = event.motion.y;
+      hoveredView = findView(mouseX, mouseY);
+      view        = event.motion.state && focusedView ? focusedView
+                                                      : hoveredView;
+      if (view) {
+        local.motion.x -= view->getX();
+        local.motion.y -= view->getY();
+      }
+      break;
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+      mouseX = event.button.x;
+      mouseY = event.button.y;
+      view   = findView(mouseX, mouseY);
+      if (event.type == SDL_MOUSEBUTTONDOWN)
+        focusedView = view;
+      else if (focusedView)
+        view = focusedView;
+      if (view) {
+        local.button.x -= view->getX();
+        local.button.y -= view->getY();
+      }
+      break;
+    case SDL_MOUSEWHEEL:
+      view = findView(mouseX, mouseY);
+      break;
+    case SDL_KEYDOWN:
+    case SDL_KEYUP:
+    case SDL_TEXTEDITING:
+    case SDL_TEXTINPUT:
+      view = focusedView ? focusedView : hoveredView;
+      break;
+    default:
+      return false;
+  }
+  if (!view || !view->hasEventCallback(event.type)) return false;
+  return view->callEventCallback(event.type, local);
+}
+
+/**
+ * @brief Enables loading of dropped files on background thread
+ * Files dropped between SDL_DROPBEGIN and SDL_DROPCOMPLETE are memory mapped
+ * as one batch. Drop file events are consumed by this window, they are not
+ * passed to event callbacks. Callbacks are called from main loop.
+ *
+ * @param batchCallback callback that receives mapped files, nullptr disables
+ * loading
+ * @param progressCallback callback that receives loading progress
+ */
+void Window::setDropCallbacks(
+    DropLoader::BatchCallback const&    batchCallback,
+    DropLoader::ProgressCallback const& progressCallback)
+{
+  if (batchCallback == nullptr) {
+    dropLoader = nullptr;
+    return;
+  }
+  if (!dropLoader) dropLoader = unique_ptr<DropLoader>(new DropLoader(getId()));
+  dropLoader->setBatchCallback(batchCallback);
+  dropLoader->setProgressCallback(progressCallback);
+}
+
+/**
+ * @brief Updates internal state of window, it is called by main loop before
+ * event callbacks
+ *
+ * @param event event that belongs to this window
+ *
+ * @return true if event was consumed and should not be passed further
+ */
+bool Window::processEvent(SDL_Event const& event)
+{
+  if (event.type == SDL_WINDOWEVENT) {
+    if (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED ||
+        event.window.event == SDL_WINDOWEVENT_RESTORED) {
+      swapchainDirty = true;
+      layoutViews();
+    }
+    if (event.window.event == SDL_WINDOWEVENT_LEAVE) hoveredView = nullptr;
+    return false;
+  }
+  if (!dropLoader) return false;
+  switch (event.type) {
+    case SDL_DROPBEGIN:
+      dropLoader->begin();
+      return true;
+    case SDL_DROPFILE:
+      dropLoader->addFile(event.drop.file);
+      SDL_free(event.drop.file);
+      return true;
+    case SDL_DROPCOMPLETE:
+      dropLoader->complete();
+      return true;
+    default:
+      if (event.type != DropLoader::getEventType()) return false;
+      dropLoader->deliver();
+      return true;
+  }
 }
 
 /**
@@ -3,13 +3,19 @@
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <SDL.h>
+#include <SDL_vulkan.h>
 
+#include <SDL2CPP/DropLoader.h>
 #include <SDL2CPP/Fwd.h>
 #include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/Status.h>
+#include <SDL2CPP/View.h>
 #include <SDL2CPP/sdl2cpp_export.h>
 
 class sdl2cpp::Window {
@@ -18,6 +24,12 @@ class sdl2cpp::Window {
  public:
   using WindowId  = uint32_t;
   using EventType = uint32_t;
+  using ContextId = uint32_t;
+  static const ContextId INVALID_CONTEXT = ~ContextId(0);
+  struct ContextSwitchStats {
+    uint64_t performed = 0;
+    uint64_t skipped   = 0;
+  };
   enum Profile {
     CORE          = SDL_GL_CONTEXT_PROFILE_CORE,
     COMPATIBILITY = SDL_GL_CONTEXT_PROFILE_COMPATIBILITY,
@@ -35,16 +47,29 @@ class sdl2cpp::Window {
     FULLSCREEN         = SDL_WINDOW_FULLSCREEN,
     FULLSCREEN_DESKTOP = SDL_WINDOW_FULLSCREEN_DESKTOP,
   };
-  SDL2CPP_EXPORT Window(uint32_t width = 1024, uint32_t height = 768);
+  enum Api {
+    OPENGL = SDL_WINDOW_OPENGL,
+    VULKAN = SDL_WINDOW_VULKAN,
+  };
+  using SwapchainCallback = std::function<void(uint32_t width, uint32_t height)>;
+  using SharedView        = std::shared_ptr<View>;
+  SDL2CPP_EXPORT Window(uint32_t width  = 1024,
+                        uint32_t height = 768,
+                        Api      api    = OPENGL);
   SDL2CPP_EXPORT ~Window();
-  SDL2CPP_EXPORT void     createContext(std::string const& name    = "context",
-                                        uint32_t           version = 450u,
-                                        Profile            profile = CORE,
-                                        Flag               flags   = NONE);
-  SDL2CPP_EXPORT void     setContext(std::string const& name,
-                                     Window const&      other,
-                                     std::string const& otherName);
-  SDL2CPP_EXPORT void     makeCurrent(std::string const& name) const;
+  SDL2CPP_EXPORT ContextId createContext(std::string const& name    = "context",
+                                         uint32_t           version = 450u,
+                                         Profile            profile = CORE,
+                                         Flag               flags   = NONE);
+  SDL2CPP_EXPORT ContextId setContext(std::string const& name,
+                                      Window const&      other,
+                                      std::string const& otherName);
+  SDL2CPP_EXPORT ContextId getContextId(std::string const& name) const;
+  SDL2CPP_EXPORT Status   makeCurrent(std::string const& name) const;
+  SDL2CPP_EXPORT Status   makeCurrent(ContextId id) const;
+  SDL2CPP_EXPORT static ContextSwitchStats getContextSwitchStats();
+  SDL2CPP_EXPORT static void               resetContextSwitchStats();
+  SDL2CPP_EXPORT static void               invalidateCurrent();
   SDL2CPP_EXPORT void     swap() const;
   SDL2CPP_EXPORT WindowId getId() const;
   SDL2CPP_EXPORT void     setEventCallback(
@@ -58,19 +83,67 @@ class sdl2cpp::Window {
   SDL2CPP_EXPORT void          setSize(uint32_t width, uint32_t height);
   SDL2CPP_EXPORT uint32_t      getWidth() const;
   SDL2CPP_EXPORT uint32_t      getHeight() const;
-  SDL2CPP_EXPORT void          setFullscreen(Fullscreen const& type);
+  SDL2CPP_EXPORT Status        setFullscreen(Fullscreen const& type);
   SDL2CPP_EXPORT Fullscreen    getFullscreen();
   SDL2CPP_EXPORT SDL_Window*   getWindow() const;
   SDL2CPP_EXPORT SDL_GLContext getContext(std::string const& name) const;
+  SDL2CPP_EXPORT SDL_GLContext getContext(ContextId id) const;
+  SDL2CPP_EXPORT Api           getApi() const;
+  SDL2CPP_EXPORT Status        getStatus() const;
+  SDL2CPP_EXPORT int           getSwapInterval() const;
+  SDL2CPP_EXPORT std::vector<char const*> getVulkanInstanceExtensions() const;
+  SDL2CPP_EXPORT VkSurfaceKHR  createVulkanSurface(VkInstance instance) const;
+  SDL2CPP_EXPORT void          getDrawableSize(uint32_t& width, uint32_t& height) const;
+  SDL2CPP_EXPORT void          setSwapchainCallback(SwapchainCallback const& callback);
+  SDL2CPP_EXPORT void          invalidateSwapchain();
+  SDL2CPP_EXPORT bool          updateSwapchain();
+  SDL2CPP_EXPORT void          addView(std::string const& name, SharedView const& view);
+  SDL2CPP_EXPORT void          removeView(std::string const& name);
+  SDL2CPP_EXPORT bool          hasView(std::string const& name) const;
+  SDL2CPP_EXPORT SharedView const& getView(std::string const& name) const;
+  SDL2CPP_EXPORT size_t        getNofViews() const;
+  SDL2CPP_EXPORT void          drawViews() const;
+  SDL2CPP_EXPORT void          setDropCallbacks(
+               DropLoader::BatchCallback const&    batchCallback,
+               DropLoader::ProgressCallback const& progressCallback = nullptr);
 
  protected:
-  using SharedSDLContext = std::shared_ptr<SDL_GLContext>;
+  // serials are never reused, unlike addresses of contexts and windows
+  // swap interval belongs to context on some drivers, so it is cached here
+  struct Context {
+    SDL_GLContext handle                = nullptr;
+    uint64_t      serial                = 0;
+    int           requestedSwapInterval = std::numeric_limits<int>::min();
+    int           swapInterval          = std::numeric_limits<int>::min();
+  };
+  using SharedSDLContext = std::shared_ptr<Context>;
   SDL_Window*                                                window = nullptr;
-  std::map<std::string, SharedSDLContext>                    contexts;
+  uint64_t                                                   serial = 0;
+  Api                                                        api    = OPENGL;
+  SwapchainCallback                                          swapchainCallback;
+  bool                                                       swapchainDirty = true;
+  std::unique_ptr<DropLoader>                                dropLoader;
+  mutable Status                                             status;
+  std::map<std::string, SharedView>                          name2View;
+  std::vector<SharedView>                                    viewOrder;
+  SharedView                                                 hoveredView;
+  SharedView                                                 focusedView;
+  int32_t                                                    mouseX = 0;
+  int32_t                                                    mouseY = 0;
+  std::vector<SharedSDLContext>                              contexts;
+  std::map<std::string, ContextId>                           contextIds;
   std::map<EventType, std::function<bool(SDL_Event const&)>> eventCallbacks;
   std::map<uint8_t, std::function<bool(SDL_Event const&)>>
             windowEventCallbacks;
   MainLoop* mainLoop;
+  ContextId internContext(std::string const& name, SharedSDLContext const& ctx);
+  Status    fail(Status::Code code, char const* where) const;
+  bool      canPresent() const;
+  void      present(int interval);
+  bool      processEvent(SDL_Event const& event);
+  void      layoutViews();
+  SharedView const& findView(int32_t x, int32_t y) const;
+  bool      callViewEventCallback(SDL_Event const& event);
   bool      defaultCloseCallback(SDL_Event const&);
   bool      callEventCallback(EventType const& eventType,
                                 SDL_Event const& eventData);
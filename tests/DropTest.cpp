@@ -0,0 +1,99 @@
+// dropped files are mapped on I/O thread and delivered as one batch, paths
+// that are not regular files (directory, FIFO) are reported as not mapped
+
+#include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/Window.h>
+
+#include "SDLStub.h"
+#include "Test.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+void sendDrop(Window const& window, Uint32 type, char const* file = nullptr)
+{
+  SDL_Event event{};
+  event.type          = type;
+  event.drop.windowID = window.getId();
+  event.drop.file     = file ? SDL_strdup(file) : nullptr;
+  SDL_PushEvent(&event);
+}
+}  // namespace
+
+int main(int, char*[])
+{
+  char directory[] = "/tmp/sdl2cppDropTestXXXXXX";
+  if (mkdtemp(directory) == nullptr) return TEST_SKIPPED;
+  auto const path = string(directory) + "/data.bin";
+  vector<char> content(3 << 20);
+  for (size_t i = 0; i < content.size(); ++i) content[i] = char(i * 7);
+  ofstream(path, ios::binary).write(content.data(), content.size());
+  // opening FIFO without writer blocks unless it is non-blocking
+  auto const fifo = string(directory) + "/fifo";
+  if (mkfifo(fifo.c_str(), 0600) != 0) return TEST_SKIPPED;
+
+  MainLoop mainLoop;
+  auto     window = make_shared<Window>(64, 64);
+  mainLoop.addWindow("window", window);
+
+  DropLoader::Batch    batch;
+  DropLoader::Progress lastProgress;
+  bool                 loaded          = false;
+  bool                 callbackCalled  = false;
+  window->setDropCallbacks(
+      [&](DropLoader::Batch const& files) {
+        batch  = files;
+        loaded = true;
+      },
+      [&](DropLoader::Progress const& progress) { lastProgress = progress; });
+  window->setEventCallback(SDL_DROPFILE, [&](SDL_Event const&) {
+    callbackCalled = true;
+    return true;
+  });
+
+  sendDrop(*window, SDL_DROPBEGIN);
+  sendDrop(*window, SDL_DROPFILE, path.c_str());
+  sendDrop(*window, SDL_DROPFILE, directory);
+  sendDrop(*window, SDL_DROPFILE, fifo.c_str());
+  sendDrop(*window, SDL_DROPCOMPLETE);
+
+  auto const start = SDL_GetTicks();
+  mainLoop.setIdleCallback([&] {
+    if (loaded || SDL_GetTicks() - start > 10000) mainLoop.stop();
+  });
+  mainLoop();
+
+  CHECK(loaded);
+  CHECK(!callbackCalled);
+  CHECK(batch.size() == 3);
+  if (batch.size() == 3) {
+    CHECK(batch[0]->isMapped());
+    CHECK(batch[0]->getSize() == content.size());
+    CHECK(batch[0]->getData() != nullptr &&
+          memcmp(batch[0]->getData(), content.data(), content.size()) == 0);
+    CHECK(!batch[1]->isMapped());
+    CHECK(!batch[1]->getError().empty());
+    CHECK(!batch[2]->isMapped());
+    CHECK(batch[2]->getSize() == 0);
+    CHECK(!batch[2]->getError().empty());
+  }
+  CHECK(lastProgress.nofFiles == 3);
+  CHECK(lastProgress.totalBytes == content.size());
+  CHECK(lastProgress.loadedBytes == lastProgress.totalBytes);
+
+  batch.clear();
+  unlink(path.c_str());
+  unlink(fifo.c_str());
+  rmdir(directory);
+  return testResult();
+}
@@ -0,0 +1,164 @@
+// flood of user events must not delay input and must stay in SDL queue
+// beyond the per-frame budget of user lane
+
+#include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/Window.h>
+
+#include "Test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+int const    nofUserEvents = 1000;
+int const    nofKeyEvents  = 10;
+size_t const budget        = 100;
+// iterations the flood needs, with a margin against a stuck loop
+int const    maxIterations = 4 * nofUserEvents / int(budget);
+// time spent by rendering in every iteration
+Uint32 const frameTime     = 2;
+
+void push(Uint32 type, Uint32 windowId)
+{
+  SDL_Event event{};
+  event.type = type;
+  if (type == SDL_KEYDOWN)
+    event.key.windowID = windowId;
+  else
+    event.user.windowID = windowId;
+  SDL_PushEvent(&event);
+}
+
+void testFlood()
+{
+  MainLoop mainLoop;
+  auto     window = make_shared<Window>(64, 64);
+  mainLoop.addWindow("window", window);
+  mainLoop.setUserEventBudget(budget);
+
+  auto const windowId = window->getId();
+  for (int i = 0; i < nofUserEvents; ++i) {
+    push(SDL_USEREVENT, windowId);
+    if (i % (nofUserEvents / nofKeyEvents) == 0) push(SDL_KEYDOWN, windowId);
+  }
+
+  int iteration  = 0;
+  int keys       = 0;
+  int lateKeys   = 0;
+  int userEvents = 0;
+  int queued     = 0;
+  window->setEventCallback(SDL_KEYDOWN, [&](SDL_Event const&) {
+    ++keys;
+    if (iteration != 0) ++lateKeys;
+    return true;
+  });
+  window->setEventCallback(SDL_USEREVENT, [&](SDL_Event const&) {
+    ++userEvents;
+    return true;
+  });
+  mainLoop.setIdleCallback([&] {
+    if (iteration == 0)
+      queued = SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_USEREVENT,
+                              SDL_LASTEVENT);
+    SDL_Delay(frameTime);
+    ++iteration;
+    if (userEvents == nofUserEvents || iteration == maxIterations)
+      mainLoop.stop();
+  });
+  mainLoop();
+
+  auto const stats = mainLoop.getEventLaneStats();
+  CHECK(keys == nofKeyEvents);
+  CHECK(lateKeys == 0);
+  CHECK(userEvents == nofUserEvents);
+  // the rest of the flood waits in SDL queue, not in the main loop
+  CHECK(queued == nofUserEvents - int(budget));
+  CHECK(stats.processed == uint64_t(nofUserEvents));
+  CHECK(stats.carriedOver > 0);
+  CHECK(stats.maxBacklog == size_t(nofUserEvents));
+  CHECK(stats.maxFrames > 0);
+  CHECK(stats.maxFrames <= nofUserEvents / budget);
+  // the last events waited for all frames before them
+  CHECK(stats.maxDelay >= std::chrono::milliseconds(frameTime));
+  CHECK(SDL_PeepEvents(nullptr, 0, SDL_PEEKEVENT, SDL_FIRSTEVENT,
+                       SDL_LASTEVENT) == 0);
+}
+
+void testTimeBudget()
+{
+  int const  nofEvents = 50;
+  auto const eventTime = std::chrono::milliseconds(1);
+  MainLoop   mainLoop;
+  auto       window = make_shared<Window>(64, 64);
+  mainLoop.addWindow("window", window);
+  mainLoop.setUserEventBudget(0, std::chrono::milliseconds(5));
+
+  auto const windowId = window->getId();
+  for (int i = 0; i < nofEvents; ++i) push(SDL_USEREVENT, windowId);
+
+  int iteration            = 0;
+  int events               = 0;
+  int eventsInIteration    = 0;
+  int maxEventsInIteration = 0;
+  window->setEventCallback(SDL_USEREVENT, [&](SDL_Event const&) {
+    SDL_Delay(Uint32(eventTime.count()));
+    ++events;
+    maxEventsInIteration = max(maxEventsInIteration, ++eventsInIteration);
+    return true;
+  });
+  mainLoop.setIdleCallback([&] {
+    eventsInIteration = 0;
+    ++iteration;
+    if (events == nofEvents || iteration == maxIterations) mainLoop.stop();
+  });
+  mainLoop();
+
+  auto const stats = mainLoop.getEventLaneStats();
+  CHECK(events == nofEvents);
+  CHECK(stats.carriedOver > 0);
+  CHECK(stats.maxFrames > 0);
+  CHECK(maxEventsInIteration < nofEvents);
+  CHECK(iteration > 1);
+}
+
+void testEventsPushedDuringDispatchWait(Uint32 type)
+{
+  MainLoop mainLoop;
+  auto     window = make_shared<Window>(64, 64);
+  mainLoop.addWindow("window", window);
+
+  auto const windowId      = window->getId();
+  int        iteration     = 0;
+  int        lastIteration = -1;
+  int        events        = 0;
+  // every event pushes the next one (input replay, ...), it has to be
+  // dispatched one iteration later, otherwise the lane never ends
+  window->setEventCallback(type, [&](SDL_Event const&) {
+    CHECK(iteration != lastIteration);
+    lastIteration = iteration;
+    if (++events < nofKeyEvents) push(type, windowId);
+    return true;
+  });
+  mainLoop.setIdleCallback([&] {
+    ++iteration;
+    if (events == nofKeyEvents || iteration == maxIterations)
+      mainLoop.stop();
+  });
+  push(type, windowId);
+  mainLoop();
+  CHECK(events == nofKeyEvents);
+}
+}  // namespace
+
+int main(int, char*[])
+{
+  testFlood();
+  testTimeBudget();
+  testEventsPushedDuringDispatchWait(SDL_USEREVENT);
+  testEventsPushedDuringDispatchWait(SDL_KEYDOWN);
+  return testResult();
+}
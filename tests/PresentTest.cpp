@@ -0,0 +1,87 @@
+// presentAll has to block on vsync once per frame, independently of number
+// of windows and of whether they share context
+
+#include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/Window.h>
+
+#include "SDLStub.h"
+#include "Test.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+int const nofFrames = 3;
+
+vector<shared_ptr<Window>> createWindows(MainLoop& mainLoop,
+                                         size_t    nofWindows,
+                                         bool      sharedContext)
+{
+  vector<shared_ptr<Window>> windows;
+  for (size_t i = 0; i < nofWindows; ++i) {
+    auto window = make_shared<Window>(64, 64);
+    if (sharedContext && i > 0)
+      window->setContext("context", *windows.front(), "context");
+    else
+      window->createContext("context");
+    mainLoop.addWindow("window" + to_string(i), window);
+    windows.push_back(window);
+  }
+  return windows;
+}
+
+void testBlockingSwaps(size_t nofWindows, bool sharedContext)
+{
+  MainLoop mainLoop;
+  auto     windows = createWindows(mainLoop, nofWindows, sharedContext);
+  stub::resetCounters();
+  for (int frame = 0; frame < nofFrames; ++frame) {
+    auto const blocking = stub::counters.blockingSwaps;
+    mainLoop.presentAll();
+    CHECK(stub::counters.blockingSwaps - blocking == 1);
+  }
+  CHECK(stub::counters.swaps == int(nofWindows) * nofFrames);
+  CHECK(stub::counters.swapsOfNonCurrent == 0);
+}
+
+void testRedundantSwapIntervals()
+{
+  MainLoop mainLoop;
+  auto     windows = createWindows(mainLoop, 4, false);
+  mainLoop.presentAll();
+  stub::resetCounters();
+  mainLoop.presentAll();
+  CHECK(stub::counters.setSwapIntervalCalls == 0);
+}
+
+void testAdaptiveFallback()
+{
+  stub::rejectAdaptiveVsync = true;
+  MainLoop mainLoop;
+  auto     windows = createWindows(mainLoop, 2, false);
+  mainLoop.setSwapInterval(-1);
+  mainLoop.presentAll();
+  CHECK(windows.front()->getSwapInterval() == 1);
+  CHECK(windows.back()->getSwapInterval() == 0);
+  stub::resetCounters();
+  for (int frame = 0; frame < nofFrames; ++frame) mainLoop.presentAll();
+  CHECK(stub::counters.setSwapIntervalCalls == 0);
+  CHECK(stub::counters.blockingSwaps == nofFrames);
+  stub::rejectAdaptiveVsync = false;
+}
+}  // namespace
+
+int main(int, char*[])
+{
+  for (size_t nofWindows = 1; nofWindows <= 4; ++nofWindows) {
+    testBlockingSwaps(nofWindows, false);
+    testBlockingSwaps(nofWindows, true);
+  }
+  testRedundantSwapIntervals();
+  testAdaptiveFallback();
+  return testResult();
+}
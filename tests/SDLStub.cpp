@@ -0,0 +1,134 @@
+#include "SDLStub.h"
+
+#include <SDL.h>
+#include <SDL_vulkan.h>
+
+#include <map>
+
+namespace stub {
+Counters counters;
+bool     rejectAdaptiveVsync = false;
+bool     failFullscreen      = false;
+bool     failCreateWindow    = false;
+int      drawableScale       = 1;
+
+void resetCounters() { counters = Counters(); }
+}  // namespace stub
+
+using namespace stub;
+
+namespace {
+struct Window {
+  Uint32 id;
+  int    width;
+  int    height;
+  Uint32 flags;
+};
+struct Context {
+  int swapInterval = 0;
+};
+Uint32      nextWindowId   = 1;
+SDL_Window* currentWindow  = nullptr;
+Context*    currentContext = nullptr;
+
+Window* fake(SDL_Window* window) { return reinterpret_cast<Window*>(window); }
+}  // namespace
+
+extern "C" {
+
+SDL_Window* SDL_CreateWindow(const char*, int, int, int w, int h, Uint32 flags)
+{
+  if (failCreateWindow) {
+    SDL_SetError("no video device");
+    return nullptr;
+  }
+  return reinterpret_cast<SDL_Window*>(new Window{nextWindowId++, w, h, flags});
+}
+
+void SDL_DestroyWindow(SDL_Window* window)
+{
+  if (window == currentWindow) currentWindow = nullptr;
+  delete fake(window);
+}
+
+Uint32 SDL_GetWindowID(SDL_Window* window) { return fake(window)->id; }
+
+Uint32 SDL_GetWindowFlags(SDL_Window* window) { return fake(window)->flags; }
+
+void SDL_SetWindowSize(SDL_Window* window, int w, int h)
+{
+  fake(window)->width  = w;
+  fake(window)->height = h;
+}
+
+void SDL_GetWindowSize(SDL_Window* window, int* w, int* h)
+{
+  *w = fake(window)->width;
+  *h = fake(window)->height;
+}
+
+void SDL_GL_GetDrawableSize(SDL_Window* window, int* w, int* h)
+{
+  SDL_GetWindowSize(window, w, h);
+  *w *= drawableScale;
+  *h *= drawableScale;
+}
+
+void SDL_Vulkan_GetDrawableSize(SDL_Window* window, int* w, int* h)
+{
+  SDL_GetWindowSize(window, w, h);
+}
+
+int SDL_SetWindowFullscreen(SDL_Window* window, Uint32 flags)
+{
+  if (failFullscreen) return SDL_SetError("fullscreen is not supported");
+  fake(window)->flags = flags;
+  return 0;
+}
+
+int SDL_GL_SetAttribute(SDL_GLattr, int) { return 0; }
+
+SDL_GLContext SDL_GL_CreateContext(SDL_Window* window)
+{
+  currentWindow  = window;
+  currentContext = new Context;
+  return currentContext;
+}
+
+void SDL_GL_DeleteContext(SDL_GLContext context)
+{
+  if (context == currentContext) currentContext = nullptr;
+  delete static_cast<Context*>(context);
+}
+
+int SDL_GL_MakeCurrent(SDL_Window* window, SDL_GLContext context)
+{
+  ++counters.makeCurrentCalls;
+  currentWindow  = window;
+  currentContext = static_cast<Context*>(context);
+  return 0;
+}
+
+int SDL_GL_SetSwapInterval(int interval)
+{
+  ++counters.setSwapIntervalCalls;
+  if (currentContext == nullptr) return SDL_SetError("no current context");
+  if (interval == -1 && rejectAdaptiveVsync)
+    return SDL_SetError("adaptive vsync is not supported");
+  currentContext->swapInterval = interval;
+  return 0;
+}
+
+int SDL_GL_GetSwapInterval(void)
+{
+  return currentContext ? currentContext->swapInterval : 0;
+}
+
+void SDL_GL_SwapWindow(SDL_Window* window)
+{
+  ++counters.swaps;
+  if (window != currentWindow) ++counters.swapsOfNonCurrent;
+  if (currentContext && currentContext->swapInterval != 0)
+    ++counters.blockingSwaps;
+}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// Stub of SDL window and OpenGL functions. The definitions in SDLStub.cpp
+// take precedence over libSDL2 when they are linked into test executable,
+// so tests run headless with SDL_VIDEODRIVER=dummy. Swap interval is kept
+// per context, as on drivers where that is the worst case.
+
+namespace stub {
+struct Counters {
+  int swaps                = 0;
+  int blockingSwaps        = 0;
+  int swapsOfNonCurrent    = 0;
+  int setSwapIntervalCalls = 0;
+  int makeCurrentCalls     = 0;
+};
+extern Counters counters;
+extern bool     rejectAdaptiveVsync;
+extern bool     failFullscreen;
+extern bool     failCreateWindow;
+// drawable size is window size multiplied by this scale (HiDPI)
+extern int      drawableScale;
+void            resetCounters();
+}  // namespace stub
@@ -0,0 +1,130 @@
+// failed calls are reported by getStatus in both build modes, they throw
+// by default and return the same status with SDL2CPP_NO_EXCEPTIONS
+
+#include <SDL2CPP/Exception.h>
+#include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/Window.h>
+
+#include "SDLStub.h"
+#include "Test.h"
+
+#include <cstring>
+#include <memory>
+
+using namespace sdl2cpp;
+using namespace std;
+
+// expression has to throw, or return failed value without exceptions
+#if defined(SDL2CPP_NO_EXCEPTIONS)
+#define CHECK_FAILS(expression, failed) CHECK((expression) == (failed))
+#else
+#define CHECK_FAILS(expression, failed)    \
+  do {                                     \
+    bool thrown = false;                   \
+    try {                                  \
+      static_cast<void>(expression);       \
+    } catch (ex::Exception const&) {       \
+      thrown = true;                       \
+    }                                      \
+    CHECK(thrown);                         \
+  } while (0)
+#endif
+
+namespace {
+bool isFailure(Status const& status, Status::Code code, char const* where)
+{
+  return status.getCode() == code && strcmp(status.getWhere(), where) == 0;
+}
+
+void testAddNullWindow()
+{
+  MainLoop mainLoop;
+  CHECK(mainLoop.getStatus());
+  CHECK_FAILS(mainLoop.addWindow("window", nullptr).getCode(),
+              Status::INVALID_ARGUMENT);
+  CHECK(isFailure(mainLoop.getStatus(), Status::INVALID_ARGUMENT,
+                  "MainLoop::addWindow"));
+  CHECK(mainLoop.getNofWindows() == 0);
+}
+
+void testAddFailedWindow()
+{
+  MainLoop mainLoop;
+  stub::failCreateWindow = true;
+#if defined(SDL2CPP_NO_EXCEPTIONS)
+  auto const failed = make_shared<Window>(64, 64);
+  CHECK(isFailure(failed->getStatus(), Status::CREATE_WINDOW, "Window"));
+  CHECK_FAILS(mainLoop.addWindow("window", failed).getCode(),
+              Status::INVALID_ARGUMENT);
+  CHECK(isFailure(mainLoop.getStatus(), Status::INVALID_ARGUMENT,
+                  "MainLoop::addWindow"));
+  CHECK(mainLoop.getNofWindows() == 0);
+#else
+  CHECK_FAILS(make_shared<Window>(64, 64), nullptr);
+#endif
+  stub::failCreateWindow = false;
+
+  // window whose later call failed is still usable
+  auto const window = make_shared<Window>(64, 64);
+  stub::failFullscreen = true;
+  CHECK_FAILS(window->setFullscreen(Window::FULLSCREEN).getCode(),
+              Status::SET_FULLSCREEN);
+  stub::failFullscreen = false;
+  CHECK(mainLoop.addWindow("window", window));
+  CHECK(mainLoop.getNofWindows() == 1);
+}
+
+void testContextOfVulkanWindow()
+{
+  Window window(64, 64, Window::VULKAN);
+  CHECK(window.getStatus());
+  CHECK_FAILS(window.createContext("context"), Window::INVALID_CONTEXT);
+  CHECK(isFailure(window.getStatus(), Status::INVALID_ARGUMENT,
+                  "Window::createContext"));
+}
+
+void testUnknownContext()
+{
+  Window window(64, 64);
+  window.createContext("context");
+  CHECK(window.makeCurrent("context"));
+  CHECK(window.getStatus());
+
+  CHECK_FAILS(window.makeCurrent("unknown").getCode(),
+              Status::INVALID_ARGUMENT);
+  CHECK(isFailure(window.getStatus(), Status::INVALID_ARGUMENT,
+                  "Window::makeCurrent"));
+  CHECK_FAILS(window.makeCurrent(Window::ContextId(1)).getCode(),
+              Status::INVALID_ARGUMENT);
+
+  Window other(64, 64);
+  CHECK_FAILS(other.setContext("context", window, "unknown"),
+              Window::INVALID_CONTEXT);
+  CHECK(isFailure(other.getStatus(), Status::INVALID_ARGUMENT,
+                  "Window::setContext"));
+  CHECK(other.getContextId("context") == Window::INVALID_CONTEXT);
+}
+
+void testFullscreenFailure()
+{
+  Window window(64, 64);
+  stub::failFullscreen = true;
+  CHECK_FAILS(window.setFullscreen(Window::FULLSCREEN).getCode(),
+              Status::SET_FULLSCREEN);
+  stub::failFullscreen = false;
+  auto const status = window.getStatus();
+  CHECK(isFailure(status, Status::SET_FULLSCREEN, "Window::setFullscreen"));
+  CHECK(strcmp(status.getSDLError(), "fullscreen is not supported") == 0);
+  CHECK(window.getFullscreen() == Window::WINDOW);
+}
+}  // namespace
+
+int main(int, char*[])
+{
+  testAddNullWindow();
+  testAddFailedWindow();
+  testContextOfVulkanWindow();
+  testUnknownContext();
+  testFullscreenFailure();
+  return testResult();
+}
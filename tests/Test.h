@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdio>
+
+// tests are plain executables, they have to build with -fno-exceptions too
+#define CHECK(expression)                                                   \
+  do {                                                                      \
+    if (!(expression)) {                                                    \
+      std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, \
+                   #expression);                                            \
+      ++testFailures();                                                     \
+    }                                                                       \
+  } while (0)
+
+// return code that CTest reports as skipped test
+#define TEST_SKIPPED 77
+
+inline int& testFailures()
+{
+  static int failures = 0;
+  return failures;
+}
+
+inline int testResult()
+{
+  if (testFailures() == 0) return 0;
+  std::fprintf(stderr, "%d check(s) failed\n", testFailures());
+  return 1;
+}
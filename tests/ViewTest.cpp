@@ -0,0 +1,76 @@
+// views have to be laid out again when drawable size changes without
+// change of window size
+
+#include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/View.h>
+#include <SDL2CPP/Window.h>
+
+#include "SDLStub.h"
+#include "Test.h"
+
+#include <memory>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+void sendSizeChanged(Window const& window)
+{
+  SDL_Event event{};
+  event.type            = SDL_WINDOWEVENT;
+  event.window.windowID = window.getId();
+  event.window.event    = SDL_WINDOWEVENT_SIZE_CHANGED;
+  SDL_PushEvent(&event);
+}
+
+void runOnce(MainLoop& mainLoop)
+{
+  mainLoop.setIdleCallback([&] { mainLoop.stop(); });
+  mainLoop();
+}
+}  // namespace
+
+int main(int, char*[])
+{
+  MainLoop mainLoop;
+  auto     window = make_shared<Window>(64, 64);
+  window->createContext("context");
+  mainLoop.addWindow("window", window);
+
+  auto     view         = make_shared<View>(0.5f, 0.f, 0.5f, 1.f);
+  int      resizes      = 0;
+  uint32_t resizeWidth  = 0;
+  uint32_t resizeHeight = 0;
+  view->setResizeCallback([&](uint32_t glWidth, uint32_t glHeight) {
+    ++resizes;
+    resizeWidth  = glWidth;
+    resizeHeight = glHeight;
+  });
+  window->addView("view", view);
+  CHECK(resizes == 1);
+  CHECK(resizeWidth == 32 && resizeHeight == 64);
+
+  int32_t  x, y;
+  uint32_t width, height;
+  view->getGLViewport(x, y, width, height);
+  CHECK(x == 32 && y == 0 && width == 32 && height == 64);
+
+  // window is moved to monitor with twice the pixel density
+  stub::drawableScale = 2;
+  sendSizeChanged(*window);
+  runOnce(mainLoop);
+  CHECK(resizes == 2);
+  // callback receives pixel size, window size of the view stays the same
+  CHECK(resizeWidth == 64 && resizeHeight == 128);
+  CHECK(view->getWidth() == 32 && view->getHeight() == 64);
+  view->getGLViewport(x, y, width, height);
+  CHECK(x == 64 && y == 0 && width == 64 && height == 128);
+
+  // nothing changed
+  sendSizeChanged(*window);
+  runOnce(mainLoop);
+  CHECK(resizes == 2);
+
+  stub::drawableScale = 1;
+  return testResult();
+}
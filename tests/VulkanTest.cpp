@@ -0,0 +1,127 @@
+// Vulkan window test, it runs on CPU with Mesa lavapipe:
+// VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json
+// It is skipped if there is no video driver or Vulkan implementation.
+
+#include <vulkan/vulkan.h>
+
+#include <SDL2CPP/MainLoop.h>
+#include <SDL2CPP/Window.h>
+
+#include "Test.h"
+
+#include <memory>
+#include <vector>
+
+using namespace sdl2cpp;
+using namespace std;
+
+namespace {
+// constructors fail if SDL has no video device, the test is skipped then
+template <typename T, typename... Args>
+shared_ptr<T> create(Args... args)
+{
+#if defined(SDL2CPP_NO_EXCEPTIONS)
+  auto object = make_shared<T>(args...);
+  if (!object->getStatus()) return nullptr;
+  return object;
+#else
+  try {
+    return make_shared<T>(args...);
+  } catch (std::exception const&) {
+    return nullptr;
+  }
+#endif
+}
+
+void sendResize(Window const& window)
+{
+  SDL_Event event{};
+  event.type            = SDL_WINDOWEVENT;
+  event.window.windowID = window.getId();
+  event.window.event    = SDL_WINDOWEVENT_SIZE_CHANGED;
+  SDL_PushEvent(&event);
+}
+}  // namespace
+
+int main(int, char*[])
+{
+  auto const mainLoopPtr = create<MainLoop>();
+  auto const window      = mainLoopPtr
+                               ? create<Window>(320u, 240u, Window::VULKAN)
+                               : nullptr;
+  if (!window) {
+    std::fprintf(stderr, "skipped: %s\n", SDL_GetError());
+    return TEST_SKIPPED;
+  }
+  auto& mainLoop = *mainLoopPtr;
+  CHECK(window->getApi() == Window::VULKAN);
+
+  auto const extensions = window->getVulkanInstanceExtensions();
+  CHECK(!extensions.empty());
+
+  auto const getInstanceProcAddr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
+      SDL_Vulkan_GetVkGetInstanceProcAddr());
+  if (getInstanceProcAddr == nullptr) return TEST_SKIPPED;
+  auto const createInstance = reinterpret_cast<PFN_vkCreateInstance>(
+      getInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+
+  VkInstanceCreateInfo instanceInfo{};
+  instanceInfo.sType                   = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+  instanceInfo.enabledExtensionCount   = uint32_t(extensions.size());
+  instanceInfo.ppEnabledExtensionNames = extensions.data();
+  VkInstance instance                  = VK_NULL_HANDLE;
+  if (createInstance(&instanceInfo, nullptr, &instance) != VK_SUCCESS) {
+    std::fprintf(stderr, "skipped: no Vulkan implementation\n");
+    return TEST_SKIPPED;
+  }
+#define LOAD(name) \
+  auto const name = reinterpret_cast<PFN_##name>(getInstanceProcAddr(instance, #name))
+  LOAD(vkDestroyInstance);
+  LOAD(vkDestroySurfaceKHR);
+  LOAD(vkEnumeratePhysicalDevices);
+  LOAD(vkGetPhysicalDeviceSurfaceCapabilitiesKHR);
+#undef LOAD
+
+  auto const surface = window->createVulkanSurface(instance);
+  CHECK(surface != VK_NULL_HANDLE);
+
+  uint32_t nofDevices = 1;
+  VkPhysicalDevice device = VK_NULL_HANDLE;
+  vkEnumeratePhysicalDevices(instance, &nofDevices, &device);
+  CHECK(device != VK_NULL_HANDLE);
+
+  // swapchain has to be created with the size that the surface reports
+  uint32_t nofRecreations = 0;
+  window->setSwapchainCallback([&](uint32_t width, uint32_t height) {
+    ++nofRecreations;
+    VkSurfaceCapabilitiesKHR capabilities;
+    CHECK(vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+              device, surface, &capabilities) == VK_SUCCESS);
+    if (capabilities.currentExtent.width != 0xFFFFFFFF) {
+      CHECK(capabilities.currentExtent.width == width);
+      CHECK(capabilities.currentExtent.height == height);
+    }
+  });
+
+  CHECK(window->updateSwapchain());
+  CHECK(nofRecreations == 1);
+  CHECK(window->updateSwapchain());
+  CHECK(nofRecreations == 1);
+
+  // resize event marks swapchain out of date, even if event handler serves it
+  mainLoop.addWindow("window", window);
+  mainLoop.setEventHandler([](SDL_Event const&) { return true; });
+  mainLoop.setIdleCallback([&] { mainLoop.stop(); });
+  sendResize(*window);
+  mainLoop();
+  CHECK(window->updateSwapchain());
+  CHECK(nofRecreations == 2);
+
+  window->invalidateSwapchain();
+  CHECK(window->updateSwapchain());
+  CHECK(nofRecreations == 3);
+
+  vkDestroySurfaceKHR(instance, surface, nullptr);
+  vkDestroyInstance(instance, nullptr);
+  return testResult();
+}